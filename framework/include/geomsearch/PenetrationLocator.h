@@ -19,6 +19,8 @@
 #include "libmesh/point.h"
 #include "libmesh/fe_base.h"
 
+#include <unordered_map>
+
 // Forward Declarations
 class SubProblem;
 class MooseMesh;
@@ -88,6 +90,13 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
+  /**
+   * Set the distance the slave and master nodes may move before the penetration is searched
+   * again. Until then the penetration info found by the last search is reused. With the default
+   * of zero the penetration is searched on every update.
+   */
+  void setUpdateTolerance(Real update_tolerance);
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -101,6 +110,18 @@ protected:
 
   const Moose::PatchUpdateType _patch_update_strategy; // Contact patch update strategy
 
+  /// Distance the nodes may move before the penetration is searched again
+  Real _update_tolerance;
+
+  /// Positions of the slave and master nodes at the last search, used with the update tolerance
+  std::unordered_map<dof_id_type, Point> _search_positions;
+
+  /**
+   * Returns true if a slave or master node moved more than the update tolerance since the last
+   * search, in which case the current positions are stored for the next check
+   */
+  bool nodesMoved();
+
   /// Timers
   PerfID _detect_penetration_timer;
   PerfID _reinit_timer;
@@ -780,6 +780,8 @@ public:
     std::vector<Elem *> _elems;
     /// master and slave ID of the interface
     BoundaryName _master, _slave;
+    /// Distance the interface may move before the master and slave sides are paired again
+    Real _update_tolerance = 0;
   };
 
   void addMortarInterface(const std::string & name,
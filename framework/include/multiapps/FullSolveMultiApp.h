@@ -39,7 +39,10 @@ public:
 
   virtual bool isSolved() const override { return _solved; }
 
-private:
+  virtual void resetApp(unsigned int global_app, Real time = 0.0) override;
+
+protected:
+  /// The Executioner for each local App
   std::vector<Executioner *> _executioners;
 
   /// Whether or not this MultiApp has already been solved.
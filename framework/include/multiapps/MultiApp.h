@@ -320,6 +320,22 @@ protected:
    */
   void init(unsigned int num);
 
+  /**
+   * Store a snapshot of the given local App for use by resetApp() when 'reset_in_place' is
+   * enabled; this does nothing otherwise.  Derived classes call this once the App has been fully
+   * set up (i.e., after the Executioner has been initialized).
+   *
+   * @param local_app The local app number to snapshot.
+   */
+  void backupInitialAppState(unsigned int local_app);
+
+  /**
+   * Whether or not resetApp() will restore the given local App in place.
+   *
+   * @param local_app The local app number in question.
+   */
+  bool resetInPlace(unsigned int local_app) const;
+
   /// The FEProblemBase this MultiApp is part of
   FEProblemBase & _fe_problem;
 
@@ -395,6 +411,12 @@ protected:
   /// Whether or not apps have been reset
   bool _reset_happened;
 
+  /// Whether or not apps are reset by restoring a snapshot rather than being recreated
+  const bool _reset_in_place;
+
+  /// Snapshots of each local App taken right after setup, used when '_reset_in_place' is true
+  std::vector<std::shared_ptr<Backup>> _initial_backups;
+
   /// The time at which to move apps
   Real _move_time;
 
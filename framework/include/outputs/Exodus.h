@@ -112,6 +112,12 @@ protected:
    */
   virtual std::string filename() override;
 
+  /**
+   * Returns the name of the file being written, which is in the staging directory when the output
+   * is asynchronous
+   */
+  std::string stagedFilename();
+
   /// Pointer to the libMesh::ExodusII_IO object that performs the actual data output
   std::unique_ptr<ExodusII_IO> _exodus_io_ptr;
 
@@ -167,6 +173,9 @@ private:
 
   /// Flag to output discontinuous format in Exodus
   bool _discontinuous;
+
+  /// The directory the file is written to before it is copied in the background (empty if none)
+  const std::string _staging_directory;
 };
 
 #endif /* EXODUS_H */
@@ -75,6 +75,12 @@ protected:
    */
   virtual std::string filename() override;
 
+  /**
+   * Returns the name given to the Nemesis_IO object, which is in the staging directory when the
+   * output is asynchronous
+   */
+  std::string stagedFilename();
+
   /// Pointer to the libMesh::NemesisII_IO object that performs the actual data output
   std::unique_ptr<Nemesis_IO> _nemesis_io_ptr;
 
@@ -93,6 +99,9 @@ private:
 
   /// Flag if the output has been initialized
   bool _nemesis_initialized;
+
+  /// The directory the files are written to before they are copied in the background (empty if none)
+  const std::string _staging_directory;
 };
 
 #endif /* NEMESIS_H */
@@ -14,6 +14,7 @@
 #include "Output.h"
 
 // Forward declarations
+class AsyncOutputWriter;
 class FEProblemBase;
 class InputParameters;
 
@@ -192,6 +193,16 @@ public:
   /// Returns a Boolean indicating whether performance logging is requested in this application
   bool getLoggingRequested() const { return _logging_requested; }
 
+  /**
+   * Return the writer that copies staged output files to their final location in the background
+   */
+  AsyncOutputWriter & asyncOutputWriter();
+
+  /**
+   * Blocks until the staged output files are copied to their final location
+   */
+  void flushAsyncOutput();
+
 private:
   /**
    * Calls the outputStep method for each output object
@@ -345,6 +356,9 @@ private:
   /// Indicates that performance logging has been requested by the console or some object (PerformanceData)
   bool _logging_requested;
 
+  /// The background writer of staged output files, created when first requested
+  std::unique_ptr<AsyncOutputWriter> _async_output_writer;
+
   // Allow complete access:
   // FEProblemBase for calling initial, timestepSetup, outputStep, etc. methods
   friend class FEProblemBase;
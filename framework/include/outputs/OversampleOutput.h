@@ -23,6 +23,9 @@ namespace libMesh
 template <typename T>
 class NumericVector;
 class MeshFunction;
+class MeshRefinement;
+class BoundingBox;
+class Elem;
 }
 
 template <>
@@ -38,6 +41,10 @@ InputParameters validParams<OversampleOutput>();
  * The use of oversampling is triggered by setting the oversample input parameter to a
  * integer value greater than 0, indicating the number of refinements to perform.
  *
+ * The output may also be restricted to a region of interest, given by blocks, boundaries and/or a
+ * bounding box. The elements outside of the region are either removed from the output mesh or, when
+ * the mesh is refined, coarsened so that the rest of the domain is written at a lower resolution.
+ *
  * @see Exodus
  */
 class OversampleOutput : public AdvancedOutput
@@ -76,6 +83,9 @@ protected:
   /// The number of oversampling refinements
   const unsigned int _refinements;
 
+  /// Flag indicating that the output is restricted to a region of interest
+  const bool _restrict_to_region;
+
   /// Flag indicating that oversampling is enabled
   bool _oversample;
 
@@ -98,6 +108,25 @@ private:
    */
   void cloneMesh();
 
+  /**
+   * Removes the elements (and the nodes only they use) outside of the region of interest from the
+   * cloned mesh. Elements are removed along with their whole refinement tree, based on their top
+   * level parent.
+   */
+  void removeOutsideRegion();
+
+  /**
+   * Coarsens the refined elements outside of the region of interest by the requested number of
+   * levels.
+   */
+  void coarsenOutsideRegion(MeshRefinement & mesh_refinement);
+
+  /**
+   * Returns true if the element is in the region of interest. The block and bounding box
+   * restrictions use the element itself, the boundary restriction uses its top level parent.
+   */
+  bool inRegion(const Elem * elem) const;
+
   /**
    * A vector of pointers to the mesh functions
    * This is only populated when the oversample() function is called, it must
@@ -108,6 +137,19 @@ private:
   /// When oversampling, the output is shift by this amount
   Point _position;
 
+  ///@{
+  /// The restrictions defining the region of interest (empty when not restricted)
+  std::set<SubdomainID> _region_blocks;
+  std::vector<BoundaryID> _region_boundaries;
+  std::unique_ptr<BoundingBox> _region_box;
+  ///@}
+
+  /// True when the elements outside of the region of interest are coarsened instead of removed
+  const bool _coarsen_outside_region;
+
+  /// The number of times the elements outside of the region of interest are coarsened
+  const unsigned int _outside_coarsenings;
+
   /// A flag indicating that the mesh has changed and the oversampled mesh needs to be re-initialized
   bool _oversample_mesh_changed;
 
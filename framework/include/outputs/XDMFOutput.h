@@ -0,0 +1,150 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef XDMFOUTPUT_H
+#define XDMFOUTPUT_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+
+// Forward declarations
+class XDMFOutput;
+
+template <>
+InputParameters validParams<XDMFOutput>();
+
+/**
+ * Class for output data to a single HDF5 file described by an XDMF file.
+ *
+ * All processors write their local nodes, elements and field values collectively to the same
+ * HDF5 file. The mesh is written once (and again when it changes), each output adds a group of
+ * field values. The datasets are chunked and optionally compressed. The XDMF file, written by
+ * the first processor, describes the time series for visualization tools.
+ */
+class XDMFOutput : public AdvancedOutput
+{
+public:
+  /**
+   * Class constructor
+   */
+  XDMFOutput(const InputParameters & parameters);
+
+  /**
+   * Closes the HDF5 file
+   */
+  virtual ~XDMFOutput();
+
+  /**
+   * Set flag indicating that the mesh has changed
+   */
+  virtual void meshChanged() override;
+
+protected:
+  /**
+   * Writes the mesh if needed, the field values and the XDMF file
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Writes the nodal variables of the current output
+   */
+  virtual void outputNodalVariables() override;
+
+  /**
+   * Writes the elemental variables of the current output
+   */
+  virtual void outputElementalVariables() override;
+
+  /**
+   * Returns the name of the XDMF file
+   */
+  virtual std::string filename() override;
+
+  /**
+   * Returns the name of the HDF5 file holding the data
+   */
+  std::string h5Filename() const;
+
+private:
+  /**
+   * Opens the HDF5 file, an existing file is appended to when recovering
+   */
+  void openFile();
+
+  /**
+   * Writes the nodal coordinates and the element connectivity of the current mesh
+   */
+  void outputMesh();
+
+  /**
+   * Writes the XDMF file describing all the outputs in the HDF5 file
+   */
+  void outputXDMF();
+
+  /**
+   * Creates a group in the HDF5 file, an existing group of the same name is replaced
+   * @return The group id, which must be closed by the caller
+   */
+  long createGroup(const std::string & path);
+
+  /**
+   * Collectively writes a dataset, each processor providing some of its rows
+   * @param group The group the dataset is created in
+   * @param name The name of the dataset
+   * @param n_rows The number of rows of the dataset
+   * @param n_cols The number of columns of the dataset (1 creates a one dimensional dataset)
+   * @param rows The (start, count) ranges of rows provided by this processor, in increasing order
+   * @param data The data of the rows provided by this processor
+   */
+  template <typename T>
+  void writeDataset(long group,
+                    const std::string & name,
+                    unsigned long long n_rows,
+                    unsigned int n_cols,
+                    const std::vector<std::pair<unsigned long long, unsigned long long>> & rows,
+                    const std::vector<T> & data);
+
+  /// The compression level of the datasets (0 for no compression)
+  const unsigned int _compression_level;
+
+  /// The number of rows of each dataset chunk
+  const unsigned int _chunk_size;
+
+  /// The HDF5 file id (negative when the file is not open)
+  long _file_id;
+
+  /// True when the mesh needs to be written before the next field values
+  bool _mesh_changed;
+
+  /// The (start, count) ranges of the rows of the local nodes of the current mesh
+  std::vector<std::pair<unsigned long long, unsigned long long>> _node_rows;
+
+  /// The nodes owned by this processor, in the order of their rows
+  std::vector<const Node *> _local_nodes;
+
+  /// The first row of the local elements of the current mesh
+  unsigned long long _first_elem_row;
+
+  ///@{
+  /// The number of nodes (rows), elements and connectivity entries of each written mesh
+  std::vector<unsigned long long> & _mesh_num_nodes;
+  std::vector<unsigned long long> & _mesh_num_elems;
+  std::vector<unsigned long long> & _mesh_connectivity_size;
+  ///@}
+
+  ///@{
+  /// The time, mesh index and nodal and elemental variable names of each output
+  std::vector<Real> & _output_times;
+  std::vector<unsigned int> & _output_meshes;
+  std::vector<std::vector<std::string>> & _output_nodal_names;
+  std::vector<std::vector<std::string>> & _output_elemental_names;
+  ///@}
+};
+
+#endif // XDMFOUTPUT_H
@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef DIFFUSIONSTABLETIMESTEP_H
+#define DIFFUSIONSTABLETIMESTEP_H
+
+#include "ElementPostprocessor.h"
+
+// Forward Declarations
+class DiffusionStableTimeStep;
+
+template <>
+InputParameters validParams<DiffusionStableTimeStep>();
+
+/**
+ * This postprocessor computes the largest stable time step of an explicit (forward Euler, lumped
+ * mass) solve of a diffusion equation, min(h^2 / (2 dim D)) over all the elements, where h is the
+ * minimum element size and D the maximum diffusivity on the element.
+ */
+class DiffusionStableTimeStep : public ElementPostprocessor
+{
+public:
+  DiffusionStableTimeStep(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+
+  virtual Real getValue() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  /// The diffusivity
+  const MaterialProperty<Real> & _diffusivity;
+
+  /// Factor the stable time step is multiplied by
+  const Real _safety_factor;
+
+  /// The smallest stable time step of the elements
+  Real _value;
+};
+
+#endif // DIFFUSIONSTABLETIMESTEP_H
@@ -1380,6 +1380,14 @@ public:
 
   void setIgnoreZerosInJacobian(bool state) { _ignore_zeros_in_jacobian = state; }
 
+  /**
+   * Number of extra nonzeros to preallocate in the Jacobian rows coupled through geometric searches
+   */
+  unsigned int geometricCouplingExtraNonzeros() const
+  {
+    return _geometric_coupling_extra_nonzeros;
+  }
+
   /// Returns whether or not this Problem has a TimeIntegrator
   bool hasTimeIntegrator() const { return _has_time_integrator; }
 
@@ -1730,6 +1738,7 @@ protected:
 private:
   bool _error_on_jacobian_nonzero_reallocation;
   bool _ignore_zeros_in_jacobian;
+  const unsigned int _geometric_coupling_extra_nonzeros;
   bool _force_restart;
   bool _skip_additional_restart_data;
   bool _fail_next_linear_convergence_check;
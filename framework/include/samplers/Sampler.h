@@ -92,7 +92,7 @@ public:
    *
    * If custom names are required then utilize the setSampleNames method.
    */
-  const std::vector<std::string> & getSampleNames() const { return _sample_names; }
+  const std::vector<std::string> & getSampleNames();
 
   /**
    * Set the sample names.
@@ -122,6 +122,48 @@ public:
    */
   unsigned int getTotalNumberOfRows();
 
+  /**
+   * Return the number of rows for a single DenseMatrix returned by getSamples().
+   * @param sample The DenseMatrix index
+   */
+  unsigned int getNumberOfRows(unsigned int sample);
+
+  /**
+   * Return the sample data for a single row.
+   * @param global_index The global row (see getLocation)
+   * @param data The storage for the row, it is resized to the number of columns as needed
+   *
+   * When 'counter_based_rng' is enabled only the requested row is computed, otherwise the
+   * complete set of samples is generated to extract the row.
+   */
+  void getSampleRow(unsigned int global_index, std::vector<Real> & data);
+
+  /**
+   * Return the sample data for a range of global rows, which are stacked into a single matrix.
+   * @param begin The first global row to include
+   * @param end One past the last global row to include
+   *
+   * All of the DenseMatrix objects returned by getSamples() must have the same number of columns.
+   */
+  DenseMatrix<Real> getSampleRows(unsigned int begin, unsigned int end);
+
+  /**
+   * Return the sample data for the rows owned by this processor.
+   *
+   * The global rows are divided into contiguous blocks, in processor order, using the same
+   * partitioning that a MultiApp uses to divide sub-applications across processors.
+   */
+  DenseMatrix<Real> getLocalSamples();
+
+  ///@{
+  /**
+   * Return the range of global rows owned by this processor.
+   */
+  unsigned int getLocalRowBegin();
+  unsigned int getLocalRowEnd();
+  unsigned int getNumberOfLocalRows();
+  ///@}
+
 protected:
   /**
    * Get the next random number from the generator.
@@ -133,11 +175,43 @@ protected:
   double rand(unsigned int index = 0);
 
   /**
-   * Base class must override this method to supply the sample distribution data.
+   * Supply the sample distribution data. By default the matrices are built one row at a time with
+   * computeSampleRow() and sampleRowCounts(), which requires 'counter_based_rng'; child classes
+   * that support the sequential generator must override this method.
    *
    * @return The list of samples for the Sampler.
    */
-  virtual std::vector<DenseMatrix<Real>> sample() = 0;
+  virtual std::vector<DenseMatrix<Real>> sample();
+
+  /**
+   * Compute the data for a single global row of the sample data when 'counter_based_rng' is
+   * enabled. Child classes that support counter-based generation must override this method
+   * and sampleRowCounts() and should generate numbers with the counterRand method, which allows
+   * each row to be computed independently without creating the complete set of samples.
+   *
+   * @param global_index The global row (see getLocation)
+   * @param data The storage for the row data, it should be resized to the number of columns
+   */
+  virtual void computeSampleRow(unsigned int global_index, std::vector<Real> & data);
+
+  /**
+   * Return the number of rows in each of the DenseMatrix objects returned by getSamples(). By
+   * default the samples are generated to compute the sizes, child classes that support
+   * 'counter_based_rng' must override this method.
+   */
+  virtual std::vector<unsigned int> sampleRowCounts();
+
+  /**
+   * Get a random number for the given row and column from the counter-based generator.
+   * @param row The global row index of the sample
+   * @param col The column index of the sample
+   * @param index The index of the seed, which provides independent streams of numbers for a
+   *              given row and column
+   *
+   * The returned value depends only on the input arguments, the 'seed' parameter, and the number
+   * of calls to execute(); thus, it is identical on all processors and threads.
+   */
+  double counterRand(unsigned int row, unsigned int col, unsigned int index = 0) const;
 
   /**
    * Set the number of seeds required by the sampler. The Sampler will generate
@@ -153,6 +227,12 @@ protected:
    */
   void reinit(const std::vector<DenseMatrix<Real>> & data);
 
+  /**
+   * Reinitialize the offsets and row counts.
+   * @param row_counts The number of rows for each DenseMatrix, as returned from sampleRowCounts()
+   */
+  void reinit(const std::vector<unsigned int> & row_counts);
+
   /// Map used to store the perturbed parameters and their corresponding distributions
   std::vector<Distribution *> _distributions;
 
@@ -162,6 +242,9 @@ protected:
   /// Sample names
   std::vector<std::string> _sample_names;
 
+  /// Flag for generating the samples one row at a time with the counter-based generator
+  const bool _counter_based_rng;
+
 private:
   /// Random number generator, don't give users access we want to control it via the interface
   /// from this class.
@@ -178,6 +261,9 @@ private:
 
   /// Total number of rows
   unsigned int _total_rows;
+
+  /// Number of calls to execute(), this is used as part of the key for the counter-based generator
+  unsigned int _execute_count;
 };
 
 #endif /* SAMPLER_H */
@@ -267,6 +267,22 @@ public:
    */
   void addImplicitGeometricCouplingEntries(GeometricSearchData & geom_search_data);
 
+  /**
+   * Doubles the number of extra nonzeros preallocated in the rows coupled through geometric
+   * searches when assembling the Jacobian needed new allocations. The larger reserve is used when
+   * the sparsity pattern is next computed, see geometricCouplingReserveGrew().
+   */
+  void updateGeometricCouplingReserve();
+
+  /**
+   * Whether the geometric coupling reserve grew since the sparsity pattern was last computed, in
+   * which case the Jacobian should be preallocated again
+   */
+  bool geometricCouplingReserveGrew() const
+  {
+    return _geometric_coupling_reserve > _geometric_coupling_reserve_preallocated;
+  }
+
   /**
    * Add jacobian contributions from Constraints
    *
@@ -743,6 +759,15 @@ protected:
   /// Whether or not to assemble the residual and Jacobian after the application of each constraint.
   bool _assemble_constraints_separately;
 
+  /// Number of extra nonzeros preallocated in the rows coupled through geometric searches
+  unsigned int _geometric_coupling_reserve;
+
+  /// The geometric coupling reserve used when the sparsity pattern was last computed
+  unsigned int _geometric_coupling_reserve_preallocated;
+
+  /// Number of allocations PETSc made when inserting new nonzeros in the Jacobian so far
+  std::size_t _jacobian_mallocs;
+
   /// Whether or not a copy of the residual needs to be made
   bool _need_serialized_solution;
 
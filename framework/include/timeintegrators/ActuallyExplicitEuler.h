@@ -79,6 +79,12 @@ protected:
 
   /// Save off current time to reset it back and forth
   Real _current_time;
+
+  /// Whether the lumped mass matrix is only assembled when dt or the mesh changes
+  const bool _constant_mass;
+
+  /// The time step size the lumped mass matrix was assembled with (zero when it must be assembled)
+  Real _mass_matrix_dt;
 };
 
 #endif // ACTUALLYEXPLICITEULER_H
@@ -11,6 +11,7 @@
 #define MULTIAPPMESHFUNCTIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 class MultiAppMeshFunctionTransfer;
@@ -24,7 +25,7 @@ InputParameters validParams<MultiAppMeshFunctionTransfer>();
  * the MultiApp is. Copies that value into a postprocessor in the MultiApp.
  * The source and destination vectors (of variables) should be ordered consistently.
  */
-class MultiAppMeshFunctionTransfer : public MultiAppTransfer
+class MultiAppMeshFunctionTransfer : public MultiAppTransfer, public MeshChangedInterface
 {
 public:
   MultiAppMeshFunctionTransfer(const InputParameters & parameters);
@@ -33,6 +34,12 @@ public:
 
   virtual void execute() override;
 
+  /**
+   * Invalidates the cached transfer plans, this is called when the mesh of the master application
+   * or of one of the sub-applications changes
+   */
+  virtual void meshChanged() override;
+
 protected:
   /// The vector of variables to transfer to
   std::vector<AuxVariableName> _to_var_name;
@@ -42,18 +49,61 @@ protected:
   unsigned int _var_size;
   bool _error_on_miss;
 
+  /// If true then the transfer plans will be cached
+  const bool _fixed_meshes;
+
 private:
   /**
    * Performs the transfer for the variable of index i
    */
   void transferVariable(unsigned int i);
 
+  /**
+   * Performs the transfer for the variable of index i using its cached transfer plan
+   */
+  void transferVariableFromPlan(unsigned int i);
+
+  /**
+   * The transfer plan of a variable, which is cached when the meshes are fixed. For the points
+   * requested by each processor the plan holds the local "from" app containing the point
+   * (invalid_uint if none) and the source dofs and interpolation weights (in compressed row
+   * format). For each local "to" app the plan holds the target dofs along with the processor and
+   * point index providing their values (invalid_processor_id if the point was not found).
+   */
+  struct TransferPlan
+  {
+    bool built = false;
+    std::vector<std::vector<unsigned int>> from_apps;
+    std::vector<std::vector<unsigned int>> offsets;
+    std::vector<std::vector<dof_id_type>> dofs;
+    std::vector<std::vector<Real>> weights;
+    std::vector<std::vector<dof_id_type>> to_dofs;
+    std::vector<std::vector<std::pair<processor_id_type, unsigned int>>> to_sources;
+  };
+
+  /// The transfer plan for each variable
+  std::vector<TransferPlan> _plans;
+
+  /// The problems of the sub-applications that notify this transfer when their mesh changes
+  std::set<FEProblemBase *> _notifying_problems;
+
   /// To send points to other processors
   std::vector<std::vector<Parallel::Request>> _send_points;
   /// To send values to other processors
   std::vector<std::vector<Parallel::Request>> _send_evals;
   /// To send app ids to other processors
   std::vector<std::vector<Parallel::Request>> _send_ids;
+
+  /// The message tags of the points, values and app ids sent for a variable
+  struct MessageTags
+  {
+    Parallel::MessageTag points;
+    Parallel::MessageTag evals;
+    Parallel::MessageTag ids;
+  };
+
+  /// The message tags for each variable
+  std::vector<MessageTags> _tags;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -22,7 +23,7 @@ InputParameters validParams<MultiAppNearestNodeTransfer>();
 /**
  * Copy the value to the target domain from the nearest node in the source domain.
  */
-class MultiAppNearestNodeTransfer : public MultiAppTransfer
+class MultiAppNearestNodeTransfer : public MultiAppTransfer, public MeshChangedInterface
 {
 public:
   MultiAppNearestNodeTransfer(const InputParameters & parameters);
@@ -31,6 +32,11 @@ public:
 
   virtual void execute() override;
 
+  /**
+   * Invalidates the cached nearest nodes
+   */
+  virtual void meshChanged() override;
+
 protected:
   /**
    * Return the nearest node to the point p.
@@ -82,6 +88,10 @@ protected:
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+
+  /// Message tags for the points and the values sent between processors
+  Parallel::MessageTag _qps_tag;
+  Parallel::MessageTag _evals_tag;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
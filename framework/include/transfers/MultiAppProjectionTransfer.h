@@ -11,6 +11,7 @@
 #define MULTIAPPPROJECTIONTRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "MeshChangedInterface.h"
 
 // Forward declarations
 namespace libMesh
@@ -26,7 +27,7 @@ InputParameters validParams<MultiAppProjectionTransfer>();
 /**
  * Project values from one domain to another
  */
-class MultiAppProjectionTransfer : public MultiAppTransfer
+class MultiAppProjectionTransfer : public MultiAppTransfer, public MeshChangedInterface
 {
 public:
   MultiAppProjectionTransfer(const InputParameters & parameters);
@@ -35,6 +36,11 @@ public:
 
   virtual void execute() override;
 
+  /**
+   * Invalidates the cached quadrature point evaluations and mass matrices
+   */
+  virtual void meshChanged() override;
+
 protected:
   void toMultiApp();
   void fromMultiApp();
@@ -43,11 +49,20 @@ protected:
 
   void projectSolution(unsigned int to_problem);
 
+  /**
+   * Scales the projected solution so that its integral matches the integral of the transferred
+   * quadrature point values
+   */
+  void preserveIntegral(unsigned int to_problem);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
   MooseEnum _proj_type;
 
+  /// If true, the integral of the transferred values is preserved by the projection
+  const bool _preserve_integral;
+
   /// True, if we need to recompute the projection matrix
   bool _compute_matrix;
   std::vector<LinearImplicitSystem *> _proj_sys;
@@ -57,11 +72,25 @@ protected:
 
   friend void assemble_l2(EquationSystems & es, const std::string & system_name);
 
-  // These variables allow us to cache qps for fixed meshes.
+  // These variables allow us to cache the quadrature point evaluations for fixed meshes.
   bool _fixed_meshes;
   bool _qps_cached;
-  std::vector<std::vector<Point>> _cached_qps;
-  std::vector<std::map<std::pair<unsigned int, unsigned int>, unsigned int>> _cached_index_map;
+
+  ///@{
+  /// For the qps requested by each processor: the local "from" app containing the qp (invalid_uint
+  /// if none) and the source dofs and interpolation weights (in compressed row format)
+  std::vector<std::vector<unsigned int>> _cached_from_apps;
+  std::vector<std::vector<unsigned int>> _cached_offsets;
+  std::vector<std::vector<dof_id_type>> _cached_dofs;
+  std::vector<std::vector<Real>> _cached_weights;
+  ///@}
+
+  ///@{
+  /// For each local "to" app: the map from element ids to their first evaluation and the processor
+  /// and index of the value used for each evaluation (invalid_processor_id if there is none)
+  std::vector<std::map<dof_id_type, unsigned int>> _cached_element_maps;
+  std::vector<std::vector<std::pair<processor_id_type, unsigned int>>> _cached_eval_sources;
+  ///@}
 };
 
 #endif /* MULTIAPPPROJECTIONTRANSFER_H */
@@ -13,6 +13,9 @@
 // MOOSE includes
 #include "GeneralUserObject.h"
 
+// C++ includes
+#include <thread>
+
 // Forward declarations
 namespace libMesh
 {
@@ -20,6 +23,7 @@ class ExodusII_IO;
 class EquationSystems;
 class System;
 class MeshFunction;
+class PointLocatorBase;
 template <class T>
 class NumericVector;
 }
@@ -45,6 +49,11 @@ public:
    */
   virtual void timestepSetup() override;
 
+  /**
+   * Discards the memoized point locations, the evaluation points may have moved
+   */
+  virtual void meshChanged() override;
+
   /**
    * Returns the local index for a given variable name
    * @param var_name The name of the variable for which the index is located
@@ -305,6 +314,35 @@ protected:
   std::map<const Elem *, RealGradient> evalMultiValuedMeshFunctionGradient(
       const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
 
+  /**
+   * Locates the element of the solution mesh containing a point, the located element and the
+   * reference coordinates of the point are memoized so that each point is only searched for once
+   * @param p The location at which data is desired
+   * @return The element containing the point (nullptr if outside of the mesh) and the reference
+   *         coordinates of the point within the element
+   */
+  std::pair<const Elem *, Point> locatePoint(const Point & p) const;
+
+  /**
+   * Evaluates the value of a variable at a location returned by locatePoint
+   * @param location The element and reference coordinates at which data is desired
+   * @param local_var_index The local index of the variable to extract data from
+   * @param func_num The system index to use (1 = _system; 2 = _system2)
+   */
+  Real evalLocation(const std::pair<const Elem *, Point> & location,
+                    const unsigned int local_var_index,
+                    unsigned int func_num) const;
+
+  /**
+   * Evaluates the gradient of a variable at a location returned by locatePoint
+   * @param location The element and reference coordinates at which data is desired
+   * @param local_var_index The local index of the variable to extract data from
+   * @param func_num The system index to use (1 = _system; 2 = _system2)
+   */
+  RealGradient evalLocationGradient(const std::pair<const Elem *, Point> & location,
+                                    const unsigned int local_var_index,
+                                    unsigned int func_num) const;
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -410,6 +448,39 @@ protected:
   /// True if initial_setup has executed
   bool _initialized;
 
+  /// Flag for memoizing the element and reference coordinates of the queried points
+  const bool _cache_point_locations;
+
+  /// Maximum number of point locations memoized by each thread
+  const unsigned int _point_location_cache_size;
+
+  /// The memoized point locations of a single thread
+  struct PointLocationCache
+  {
+    /// Point locator for the solution mesh, a locator may only be used by a single thread
+    std::unique_ptr<PointLocatorBase> locator;
+
+    /// The element and reference coordinates of each (transformed) queried point
+    std::map<Point, std::pair<const Elem *, Point>> locations;
+  };
+
+  /**
+   * Returns the point location cache of the calling thread, which is created on first use
+   */
+  PointLocationCache & pointLocationCache() const;
+
+  /// The point location cache of each thread that queried this object
+  mutable std::map<std::thread::id, PointLocationCache> _point_location_caches;
+
+  /// Serializes the creation of the per-thread point location caches
+  mutable Threads::spin_mutex _point_location_mutex;
+
+  /// Identifies this object in the per-thread memo of pointLocationCache(), never reused
+  const unsigned long long _point_location_cache_id;
+
+  /// The libMesh variable numbers of the extracted variables, indexed by the local index
+  std::vector<unsigned int> _var_nums;
+
 private:
   static Threads::spin_mutex _solution_user_object_mutex;
 };
@@ -0,0 +1,130 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ASYNCOUTPUTWRITER_H
+#define ASYNCOUTPUTWRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Copies output files from a staging location to their final location on a background thread.
+ *
+ * Output objects write their files to a fast (usually node-local) staging directory and call
+ * sync(), which takes a snapshot of the staged file and queues the copy of the snapshot to the
+ * final location. The simulation proceeds while the copy is written. Copies are performed in the
+ * order they are queued and a pending copy is replaced when the same file is synced again. The
+ * final file is replaced atomically, so readers never see a partially written file.
+ *
+ * The snapshot is a copy-on-write clone of the staged file, which only takes the time of a
+ * metadata update. The staged file is still open and written to by the output object, so it can
+ * not be moved or linked instead. When the staging file system does not support clones, the
+ * snapshot falls back to a full copy on the calling thread and a warning is issued, since the
+ * output then takes at least as long as writing the final file directly.
+ */
+class AsyncOutputWriter
+{
+public:
+  AsyncOutputWriter();
+
+  /**
+   * Waits for the queued copies to be written, then removes the staged files and the
+   * directories created by createStagingDirectories() once they are empty
+   */
+  ~AsyncOutputWriter();
+
+  /**
+   * Snapshots the staged file and queues the copy of the snapshot to the final file
+   * @param staged_file The file written by the output object
+   * @param final_file The destination of the copy
+   */
+  void sync(const std::string & staged_file, const std::string & final_file);
+
+  /**
+   * Blocks until all queued copies are written, errors from the background thread are reported
+   */
+  void flush();
+
+  /**
+   * Returns the staged name of a file written by the given processor
+   * @param staging_directory The root directory for staged files
+   * @param rank The processor writing the file
+   * @param file_name The final name of the file
+   */
+  static std::string
+  stagedFileName(const std::string & staging_directory, unsigned int rank, std::string file_name);
+
+  /**
+   * Creates the staging directory and the directory of the given processor if they do not exist,
+   * this must only be called by the processors that write staged files. The directories created
+   * are removed on destruction.
+   * @param staging_directory The root directory for staged files
+   * @param rank The processor writing the files
+   */
+  void createStagingDirectories(const std::string & staging_directory, unsigned int rank);
+
+  /**
+   * Copies a file, a copy-on-write clone is used when the file system supports it
+   * @param cloned Optional storage for whether a clone was used rather than a full copy
+   * @return An empty string on success, otherwise the error message
+   */
+  static std::string
+  copyFile(const std::string & from, const std::string & to, bool * cloned = nullptr);
+
+private:
+  /// The loop run by the background thread
+  void run();
+
+  /// A queued copy from a snapshot to the final file
+  struct Job
+  {
+    std::string snapshot;
+    std::string final_file;
+  };
+
+  /// The queued copies
+  std::deque<Job> _jobs;
+
+  /// True while the background thread is writing a copy
+  bool _busy;
+
+  /// True when the background thread should finish
+  bool _stop;
+
+  /// Errors from the background thread that have not been reported yet
+  std::vector<std::string> _errors;
+
+  /// The number of snapshots taken, used to give the snapshots unique names
+  unsigned int _num_snapshots;
+
+  /// The staged files that were synced, which are removed on destruction
+  std::set<std::string> _staged_files;
+
+  /// The directories created by createStagingDirectories(), in the order they were created
+  std::vector<std::string> _staging_directories;
+
+  /// True once the warning about snapshots not being clones was issued
+  bool _warned_full_copy;
+
+  ///@{
+  /// Synchronization of the queue between the threads
+  std::mutex _mutex;
+  std::condition_variable _queue_changed;
+  ///@}
+
+  /// The background thread, started on the first call to sync()
+  std::thread _thread;
+};
+
+#endif // ASYNCOUTPUTWRITER_H
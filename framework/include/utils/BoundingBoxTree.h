@@ -0,0 +1,127 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef BOUNDINGBOXTREE_H
+#define BOUNDINGBOXTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+#include "libmesh/bounding_box.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * A bounding volume hierarchy over a set of axis aligned bounding boxes, used to find the boxes
+ * intersecting a given box without testing all of them.
+ *
+ * The boxes are identified by their index, in the order they were added. Boxes may be added to
+ * an existing tree with insert(), which descends the tree and enlarges the boxes of the nodes on
+ * the way, so that a growing set of boxes (e.g. the faces of a growing crack surface) does not
+ * require rebuilding the tree. Moving boxes are refit with update().
+ */
+class BoundingBoxTree
+{
+public:
+  /**
+   * @param max_leaf_size The number of boxes in a leaf above which the leaf is split
+   */
+  BoundingBoxTree(unsigned int max_leaf_size = 8);
+
+  /**
+   * Builds the tree of the given boxes, replacing the boxes of the tree
+   */
+  void build(const std::vector<BoundingBox> & boxes);
+
+  /**
+   * Adds a box to the tree, its index is the number of boxes before the insertion
+   */
+  void insert(const BoundingBox & box);
+
+  /**
+   * Replaces the box with the given index and refits the boxes of its ancestors
+   */
+  void update(std::size_t index, const BoundingBox & box);
+
+  /**
+   * Finds the boxes intersecting the given box
+   * @param box The box to test
+   * @param indices The indices of the intersecting boxes, in increasing order
+   */
+  void intersectingBoxes(const BoundingBox & box, std::vector<std::size_t> & indices) const;
+
+  /**
+   * The box with the given index
+   */
+  const BoundingBox & box(std::size_t index) const { return _boxes[index]; }
+
+  /**
+   * The number of boxes
+   */
+  std::size_t size() const { return _boxes.size(); }
+
+  /**
+   * Removes all the boxes
+   */
+  void clear();
+
+protected:
+  /// A node of the tree, leaves hold boxes and the other nodes hold two children
+  struct Node
+  {
+    /// The box enclosing all the boxes below this node
+    BoundingBox box;
+
+    /// The parent node
+    std::size_t parent;
+
+    /// The children nodes, invalid for leaves
+    std::array<std::size_t, 2> children;
+
+    /// The indices of the boxes of a leaf
+    std::vector<std::size_t> items;
+
+    bool isLeaf() const { return children[0] == invalid; }
+  };
+
+  /**
+   * Splits a leaf along the largest extent of the centers of its boxes when it holds more than
+   * _max_leaf_size boxes, and recursively splits the new leaves
+   */
+  void split(std::size_t node);
+
+  /**
+   * Returns the center of a box
+   */
+  static Point center(const BoundingBox & box);
+
+  /**
+   * Returns the sum of the extents of a box, used as the cost of enlarging a node since the boxes
+   * of surface elements are often flat
+   */
+  static Real margin(const BoundingBox & box);
+
+  /// The index used for missing nodes
+  static const std::size_t invalid;
+
+  /// The number of boxes in a leaf above which the leaf is split
+  const unsigned int _max_leaf_size;
+
+  /// The boxes in the order they were added
+  std::vector<BoundingBox> _boxes;
+
+  /// The leaf holding each box
+  std::vector<std::size_t> _leaf;
+
+  /// The nodes of the tree, the first node is the root
+  std::vector<Node> _nodes;
+};
+
+#endif // BOUNDINGBOXTREE_H
@@ -69,6 +69,8 @@ public:
    *     HeaderFlag: Set the header flag (TRUE used the first row has header, FALSE assumes no
    *                 header, and AUTO will attempt to determine if a header exists).
    *     Comment: Set the comment character, by default no comment character is used.
+   *     BinaryCache: When true the parsed data is stored in a binary file next to the file
+   *                  ("<filename>.cache"), which is read instead while the file is unchanged.
    */
   void setIgnoreEmptyLines(bool value) { _ignore_empty_lines = value; }
   bool getIgnoreEmptyLines() const { return _ignore_empty_lines; }
@@ -84,6 +86,9 @@ public:
 
   void setComment(const std::string & value) { _row_comment = value; }
   const std::string & getComment() const { return _row_comment; }
+
+  void setBinaryCache(bool value) { _binary_cache = value; }
+  bool getBinaryCache() const { return _binary_cache; }
   ///@}
 
   /**
@@ -151,15 +156,42 @@ protected:
   /// Hide row comments
   std::string _row_comment;
 
+  /// Flag for reading/writing the binary cache of the parsed data
+  bool _binary_cache;
+
 private:
   ///@{
   /**
    * Read the numeric data as rows or columns into a single vector.
    */
-  void readColumnData(std::ifstream & stream_data, std::vector<double> & output);
-  void readRowData(std::ifstream & stream_data, std::vector<double> & output);
+  void readColumnData(const char * begin, const char * end, std::vector<double> & output);
+  void readRowData(const char * begin, const char * end, std::vector<double> & output);
   ///@}
 
+  /**
+   * Extract the next line from the buffer.
+   * @param pos The position in the buffer, it is advanced past the line.
+   * @param end The end of the buffer.
+   * @param line The string to populate.
+   * @returns False if the end of the buffer was reached.
+   */
+  bool getLine(const char *& pos, const char * end, std::string & line) const;
+
+  ///@{
+  /**
+   * Read/write the binary cache of the parsed data.
+   * @returns False (when reading) if the cache does not exist or is out of date.
+   */
+  bool readCache(const std::string & key, std::vector<double> & raw);
+  void writeCache(const std::string & key, const std::vector<double> & raw) const;
+  ///@}
+
+  /**
+   * Return the string identifying the file version and the read options, a cache is only used
+   * when it was written with the same key.
+   */
+  std::string cacheKey() const;
+
   /**
    * Populate supplied vector with content from line.
    * @param line The line to extract data from.
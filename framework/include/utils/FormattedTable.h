@@ -100,6 +100,14 @@ public:
 
   void clear();
 
+  /**
+   * Limits the number of rows held in memory. Once a table is written to a file, only rows that
+   * have already been written are discarded; rows of tables that are not written to a file
+   * (e.g. the Console) are discarded as soon as they fall outside of the last "max_rows" rows.
+   * A value of zero (the default) keeps every row.
+   */
+  void setMaxRows(std::size_t max_rows);
+
   /**
    * Set whether or not to output time column.
    */
@@ -178,12 +186,31 @@ protected:
   unsigned short getTermWidth(bool use_environment) const;
 
   /**
-   * Data structure for the console table:
-   * The first part of the pair tracks the independent variable (normally time) and is associated
-   * with the second part of the table which is the map of dependent variables and their associated
-   * values.
+   * Returns the id of the column with the given name, adding a new (zero filled) column if
+   * necessary.
+   */
+  std::size_t columnId(const std::string & name);
+
+  /**
+   * Drops the oldest rows that are no longer needed (see setMaxRows).
+   */
+  void trimRows();
+
+  /**
+   * Data structure for the table, stored by column:
+   * The independent variable (normally time) of every row held in memory is stored in _row_times,
+   * the dependent variables are stored in contiguous arrays indexed by the column id. Rows that
+   * have been discarded (see setMaxRows) are accounted for by _row_offset, which is the global
+   * index of the first row held in memory.
    */
-  std::vector<std::pair<Real, std::map<std::string, Real>>> _data;
+  ///@{
+  std::vector<Real> _row_times;
+  std::vector<std::vector<Real>> _column_data;
+  std::size_t _row_offset;
+  ///@}
+
+  /// Map from the column name to the column id (the index into _column_data)
+  std::map<std::string, std::size_t> _column_ids;
 
   /// Alignment widths (only used if asked to print aligned to CSV output)
   std::map<std::string, unsigned int> _align_widths;
@@ -204,7 +231,14 @@ private:
   /// Open or switch the underlying file stream to point to file_name. This is idempotent.
   void open(const std::string & file_name);
 
-  void printRow(std::pair<Real, std::map<std::string, Real>> & row_data, bool align);
+  /// Print the row with the given local (in memory) index, ids are the column ids in print order
+  void printRow(std::size_t row, const std::vector<std::size_t> & ids, bool align);
+
+  /**
+   * Prepares file_name to continue the output of a table loaded from restart data: the data
+   * written prior to the restart is copied from (or truncated in) the file it was written to.
+   */
+  void restoreOutput(const std::string & file_name);
 
   /// The optional output file stream
   std::string _output_file_name;
@@ -241,6 +275,21 @@ private:
   /// Flag indicating that sorting is necessary (used by sortColumns method).
   bool _column_names_unsorted = true;
 
+  /// The maximum number of rows held in memory (zero for no limit)
+  std::size_t _max_rows;
+
+  /// The number of bytes written to the output file
+  std::size_t _output_file_size;
+
+  /**
+   * The file (and its size) holding the rows written prior to a restart. Only this offset is
+   * stored in the restart data, the written rows are recovered from the file in restoreOutput.
+   */
+  ///@{
+  std::string _restored_file_name;
+  std::size_t _restored_file_size;
+  ///@}
+
   friend void
   dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
@@ -13,6 +13,7 @@
 // MOOSE includes
 #include "FileRangeBuilder.h"
 #include "ConsoleStream.h"
+#include "NodeSharedArray.h"
 
 #include "libmesh/bounding_box.h"
 
@@ -48,6 +49,9 @@ InputParameters validParams<ImageSampler>();
 
 /**
  * A helper class for reading and sampling images using VTK.
+ *
+ * The images are read and filtered by the first processor of each compute node, the resulting
+ * pixel values are stored once per node in shared memory.
  */
 class ImageSampler : public FileRangeBuilder
 {
@@ -124,6 +128,12 @@ private:
 
   /// Pointers to image flipping filter.  May be used for x, y, or z.
   vtkSmartPointer<vtkImageFlip> _flip_filter;
+
+  /// The pixel dimensions of the image, shared by the processors of a node
+  NodeSharedArray<int> _shared_dims;
+
+  /// The filtered pixel values of the image component, shared by the processors of a node
+  NodeSharedArray<Real> _pixels;
 #endif
 
 /**
@@ -133,6 +143,12 @@ private:
  */
 #ifdef LIBMESH_HAVE_VTK
   vtkSmartPointer<vtkImageFlip> imageFlip(const int & axis);
+
+  /**
+   * Reads the images and applies the filters, this is only called on the processors filling the
+   * shared pixel data
+   */
+  void readImage(const std::string & file_suffix);
 #endif
 
   /// Origin of image
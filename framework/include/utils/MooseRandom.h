@@ -70,6 +70,33 @@ public:
    */
   static inline uint32_t randl() { return mt_lrand(); }
 
+  /**
+   * Return a random number computed directly from a key and a counter, i.e., a counter-based
+   * generator. No state is stored, thus the same key and counter always produce the same number,
+   * regardless of the order, processor, or thread on which the number is requested.
+   * @param key     the key (seed) for the stream of numbers
+   * @param counter the position within the stream for the desired number
+   * @return        the random number in the range [0,1) with 53-bit precision
+   */
+  static inline double counterRand(uint64_t key, uint64_t counter)
+  {
+    return (splitMix64(splitMix64(key) ^ counter) >> 11) * (1.0 / 9007199254740992.0);
+  }
+
+  /**
+   * The SplitMix64 hash, which is used to scramble the bits of a key for the counter-based
+   * generator, see http://prng.di.unimi.it/splitmix64.c
+   * @param x     the value to hash
+   * @return      the scrambled value
+   */
+  static inline uint64_t splitMix64(uint64_t x)
+  {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
   /**
    * The method seeds one of the independent random number generators
    * @param i     the index of the generator
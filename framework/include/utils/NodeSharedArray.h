@@ -0,0 +1,195 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef NODESHAREDARRAY_H
+#define NODESHAREDARRAY_H
+
+#include "libmesh/parallel.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * An array of read-only data shared by the processors of a compute node.
+ *
+ * The array is allocated once per node in an MPI-3 shared memory window, so that large read-only
+ * data sets (images, EBSD data, ...) are not replicated on every processor. The first processor of
+ * each node (the writer) fills the array, after sync() all the processors of the node can read it.
+ * Without MPI, or when running on a single processor, the array is stored locally.
+ *
+ * The element type must be trivially destructible, the elements are value initialized.
+ */
+template <typename T>
+class NodeSharedArray
+{
+public:
+  NodeSharedArray();
+  ~NodeSharedArray();
+
+  NodeSharedArray(const NodeSharedArray &) = delete;
+  NodeSharedArray & operator=(const NodeSharedArray &) = delete;
+
+  /**
+   * Allocate the array, this is collective on the communicator
+   * @param comm The communicator of the processors reading the array
+   * @param size The number of elements
+   */
+  void allocate(const libMesh::Parallel::Communicator & comm, std::size_t size);
+
+  /**
+   * Returns true on the processors filling the array (one per node)
+   */
+  bool isWriter() const { return _is_writer; }
+
+  /**
+   * Makes the data filled by the writer visible to the other processors of the node, this is
+   * collective on the communicator given to allocate()
+   */
+  void sync();
+
+  /**
+   * Release the array, this is collective on the communicator given to allocate()
+   */
+  void clear();
+
+  ///@{
+  /**
+   * Access to the data, only the writer may modify the data and only before sync()
+   */
+  std::size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+  T * data() { return _data; }
+  const T * data() const { return _data; }
+  T & operator[](std::size_t i) { return _data[i]; }
+  const T & operator[](std::size_t i) const { return _data[i]; }
+  T * begin() { return _data; }
+  T * end() { return _data + _size; }
+  const T * begin() const { return _data; }
+  const T * end() const { return _data + _size; }
+  ///@}
+
+private:
+  /// The number of elements
+  std::size_t _size;
+
+  /// The elements, either in the shared memory window or in _local
+  T * _data;
+
+  /// True on the processor filling the array
+  bool _is_writer;
+
+  /// Storage when the array is not shared
+  std::vector<T> _local;
+
+#ifdef LIBMESH_HAVE_MPI
+  /// The communicator of the processors on this node
+  MPI_Comm _node_comm;
+
+  /// The shared memory window
+  MPI_Win _window;
+#endif
+};
+
+template <typename T>
+NodeSharedArray<T>::NodeSharedArray()
+  : _size(0),
+    _data(nullptr),
+    _is_writer(true)
+#ifdef LIBMESH_HAVE_MPI
+    ,
+    _node_comm(MPI_COMM_NULL),
+    _window(MPI_WIN_NULL)
+#endif
+{
+}
+
+template <typename T>
+NodeSharedArray<T>::~NodeSharedArray()
+{
+  clear();
+}
+
+template <typename T>
+void
+NodeSharedArray<T>::allocate(const libMesh::Parallel::Communicator & comm, std::size_t size)
+{
+  clear();
+  _size = size;
+
+#ifdef LIBMESH_HAVE_MPI
+  if (comm.size() > 1)
+  {
+    MPI_Comm_split_type(comm.get(), MPI_COMM_TYPE_SHARED, comm.rank(), MPI_INFO_NULL, &_node_comm);
+    int node_rank;
+    MPI_Comm_rank(_node_comm, &node_rank);
+    _is_writer = node_rank == 0;
+
+    // Only the writer allocates memory, the other processors map the memory of the writer
+    void * base = nullptr;
+    MPI_Win_allocate_shared(_is_writer ? size * sizeof(T) : 0,
+                            sizeof(T),
+                            MPI_INFO_NULL,
+                            _node_comm,
+                            &base,
+                            &_window);
+
+    MPI_Aint shared_size;
+    int disp_unit;
+    MPI_Win_shared_query(_window, 0, &shared_size, &disp_unit, &base);
+    _data = static_cast<T *>(base);
+
+    if (_is_writer)
+      std::uninitialized_fill_n(_data, size, T());
+
+    // Start the access epoch closed by sync()
+    MPI_Win_fence(0, _window);
+    return;
+  }
+#else
+  libmesh_ignore(comm);
+#endif
+
+  _is_writer = true;
+  _local.assign(size, T());
+  _data = _local.data();
+}
+
+template <typename T>
+void
+NodeSharedArray<T>::sync()
+{
+#ifdef LIBMESH_HAVE_MPI
+  if (_window != MPI_WIN_NULL)
+    MPI_Win_fence(0, _window);
+#endif
+}
+
+template <typename T>
+void
+NodeSharedArray<T>::clear()
+{
+#ifdef LIBMESH_HAVE_MPI
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (_window != MPI_WIN_NULL && !finalized)
+  {
+    MPI_Win_free(&_window);
+    MPI_Comm_free(&_node_comm);
+  }
+  _window = MPI_WIN_NULL;
+  _node_comm = MPI_COMM_NULL;
+#endif
+
+  std::vector<T>().swap(_local);
+  _data = nullptr;
+  _size = 0;
+  _is_writer = true;
+}
+
+#endif // NODESHAREDARRAY_H
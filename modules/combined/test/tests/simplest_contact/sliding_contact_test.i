@@ -0,0 +1,115 @@
+# A small block is pressed against a tall block and slides more than a face of the tall block in
+# each time step. The contact patches only hold the nearest node and are updated in the nonlinear
+# iterations, so the new contact pairs add entries that are not in the sparsity pattern.
+[Mesh]
+  file = sliding_blocks.e
+  patch_size = 1
+  patch_update_strategy = iteration
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[Functions]
+  [./vertical_movement]
+    type = ParsedFunction
+    value = -t
+  [../]
+[]
+
+[SolidMechanics]
+  [./solid]
+    disp_x = disp_x
+    disp_y = disp_y
+  [../]
+[]
+
+[BCs]
+  [./left_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 1
+    value = 0.0
+  [../]
+  [./left_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0.0
+  [../]
+  [./right_x]
+    type = PresetBC
+    variable = disp_x
+    boundary = 4
+    value = -0.02
+  [../]
+  [./right_y]
+    type = FunctionPresetBC
+    variable = disp_y
+    boundary = 4
+    function = vertical_movement
+  [../]
+[]
+
+[Materials]
+  [./left]
+    type = LinearIsotropicMaterial
+    block = 1
+    disp_y = disp_y
+    disp_x = disp_x
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+  [./right]
+    type = LinearIsotropicMaterial
+    block = 2
+    disp_y = disp_y
+    disp_x = disp_x
+    poissons_ratio = 0.3
+    youngs_modulus = 1e6
+  [../]
+[]
+
+[Contact]
+  [./leftright]
+    slave = 3
+    master = 2
+    model = frictionless
+    penalty = 1e+7
+    formulation = penalty
+    system = constraint
+    normal_smoothing_distance = 0.1
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = 'none'
+
+  l_max_its = 100
+  nl_max_its = 20
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-6
+  dt = 0.5
+  num_steps = 5
+[]
@@ -39,8 +39,6 @@ private:
   const EBSDReader & _ebsd_reader;
 
   unsigned int _phase;
-
-  const std::map<dof_id_type, std::vector<Real>> & _node_to_phase_weight_map;
 };
 
 #endif // RECONPHASEVARIC_H
@@ -22,18 +22,62 @@ InputParameters validParams<ACGrGrBase>();
  * This is the base class for kernels that calculate the residual for grain growth.
  * It calculates the residual of the ith order parameter, and the values of
  * all other order parameters are coupled variables and are stored in vals.
+ *
+ * Only a few order parameters are nonzero on any element, the indices of the order parameters
+ * that are nonzero at a quadrature point of the current element are collected in _active_ops
+ * so that derived classes only need to loop over those at each quadrature point.
  */
 class ACGrGrBase : public ACBulk<Real>
 {
 public:
   ACGrGrBase(const InputParameters & parameters);
 
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
 protected:
+  virtual void precalculateResidual() override;
+  virtual void precalculateJacobian() override;
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
+  /**
+   * Collects the order parameters that are nonzero on the current element into _active_ops, the
+   * Jacobian blocks of an element reuse the order parameters collected for its first block
+   */
+  void updateActiveOrderParameters(bool reuse);
+
+  /**
+   * Returns the index of the coupled order parameter of variable number jvar, or
+   * libMesh::invalid_uint when jvar is not a coupled order parameter
+   */
+  unsigned int orderParameterIndex(unsigned int jvar) const
+  {
+    return jvar < _op_index.size() ? _op_index[jvar] : libMesh::invalid_uint;
+  }
+
+  /**
+   * Returns true when the absolute value of the coupled order parameter with index op is at most
+   * _active_op_threshold at all the quadrature points of the current element
+   */
+  bool zeroOnElement(unsigned int op) const;
+
   const unsigned int _op_num;
 
   std::vector<const VariableValue *> _vals;
   std::vector<unsigned int> _vals_var;
 
+  /// Order parameters at most this value on a whole element are skipped on that element
+  const Real _active_op_threshold;
+
+  /// Indices of the coupled order parameters that are nonzero on the current element
+  std::vector<unsigned int> _active_ops;
+
+  /// The element _active_ops was collected on for the Jacobian blocks, reset with the solution
+  const Elem * _active_ops_elem;
+
+  /// Index of the coupled order parameter of each variable number
+  std::vector<unsigned int> _op_index;
+
   const MaterialProperty<Real> & _mu;
 };
 
@@ -28,6 +28,8 @@ class ACGrGrPoly : public ACGrGrBase
 public:
   ACGrGrPoly(const InputParameters & parameters);
 
+  virtual void computeOffDiagJacobian(MooseVariableFEBase & jvar) override;
+
 protected:
   virtual Real computeDFDOP(PFFunctionType type);
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
@@ -342,8 +342,9 @@ protected:
   /**
    * This method will "mark" all entities on neighboring elements that
    * are above the supplied threshold. If feature is NULL, we are exploring
-   * for a new region to mark, otherwise we are in the recursive calls
-   * currently marking a region.
+   * for a new region to mark, otherwise the entities are added to the supplied feature.
+   * The region is explored depth first using an explicit stack, so the depth of the
+   * exploration is not limited by the size of the call stack.
    *
    * @return Boolean indicating whether a new feature was found while exploring the current entity.
    */
@@ -393,6 +394,16 @@ protected:
    */
   void expandEdgeHalos(unsigned int num_layers_to_expand);
 
+  /**
+   * Marks a single entity as part of a feature, creating the feature if needed, and pushes it on
+   * the flood stack with its neighbors. This is the non-recursive part of flood().
+   *
+   * @return Boolean indicating whether the entity is part of a feature.
+   */
+  bool floodEntity(const DofObject * dof_object,
+                   std::size_t & current_index,
+                   FeatureData *& feature);
+
   ///@{
   /**
    * These two routines are utility routines used by the flood routine and by derived classes for
@@ -413,7 +424,8 @@ protected:
   /**
    * The actual logic for visiting neighbors is abstracted out here. This method is templated to
    * handle the Nodal
-   * and Elemental cases together.
+   * and Elemental cases together. The neighbors that should be flooded are appended to
+   * _flood_candidates and explored by flood().
    */
   template <typename T>
   void visitNeighborsHelper(const T * curr_entity,
@@ -455,14 +467,17 @@ protected:
 
   /**
    * This routine is called on the master rank only and stitches together the partial
-   * feature pieces seen on any processor.
+   * feature pieces seen on any processor. The pieces are labelled with a union-find over a flat
+   * vector, and only the pieces sharing a ghosted entity or a periodic node are compared.
    */
   virtual void mergeSets();
 
   /**
    * Method for determining whether two features are mergeable. This routine exists because
    * derived classes may need to override this function rather than use the mergeable method
-   * in the FeatureData object.
+   * in the FeatureData object. The default mergeSets() only calls it for features sharing a
+   * ghosted entity or a periodic node, a derived class merging other features must also override
+   * mergeSets().
    */
   virtual bool areFeaturesMergeable(const FeatureData & f1, const FeatureData & f2) const;
 
@@ -693,6 +708,25 @@ protected:
   /// Determines if the flood counter is elements or not (nodes)
   const bool _is_elemental;
 
+  /**
+   * An entity being explored by flood(): the range of its neighbors in _flood_candidates
+   * and the variable index and feature the neighbors are flooded with.
+   */
+  struct FloodFrame
+  {
+    std::size_t _current_index;
+    FeatureData * _feature;
+    std::size_t _first_candidate;
+    std::size_t _next_candidate;
+    std::size_t _end_candidate;
+  };
+
+  /// The explicit stack of flood() (the entities whose neighbors are being explored)
+  std::vector<FloodFrame> _flood_stack;
+
+  /// The neighbors of the entities in _flood_stack that remain to be flooded
+  std::vector<const DofObject *> _flood_candidates;
+
   /// Indicates that this object should only run on one or more boundaries
   bool _is_boundary_restricted;
 
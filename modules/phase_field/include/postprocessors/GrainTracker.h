@@ -15,6 +15,8 @@
 
 #include "libmesh/mesh_tools.h"
 
+#include <unordered_map>
+
 class GrainTracker;
 class PolycrystalUserObjectBase;
 struct GrainDistance;
@@ -134,21 +136,20 @@ protected:
   /**
    * A routine for moving all of the solution values from a given grain to a new variable number. It
    * is called with different modes to only cache, or actually do the work, or bypass the cache
-   * altogether.
+   * altogether. The values of all the local nodes of the grain are read and written with a single
+   * call per solution vector. The cache is indexed by variable index and node id.
    */
   void swapSolutionValues(FeatureData & grain,
                           std::size_t new_var_index,
-                          std::vector<std::map<Node *, CacheValues>> & cache,
+                          std::vector<std::unordered_map<dof_id_type, CacheValues>> & cache,
                           RemapCacheMode cache_mode);
 
   /**
-   * Helper method for actually performing the swaps.
+   * Returns, for each grain, the indices (in increasing order) of the other grains whose bounding
+   * boxes intersect its bounding boxes. The bounding boxes are binned on a uniform grid so that
+   * only grains sharing a bin are compared.
    */
-  void swapSolutionValuesHelper(Node * curr_node,
-                                std::size_t curr_var_index,
-                                std::size_t new_var_index,
-                                std::vector<std::map<Node *, CacheValues>> & cache,
-                                RemapCacheMode cache_mode);
+  std::vector<std::vector<std::size_t>> findIntersectingBoundingBoxes() const;
 
   /**
    * This method returns the minimum periodic distance between two vectors of bounding boxes. If the
@@ -249,6 +250,7 @@ private:
   const PerfID _track_grains;
   const PerfID _broadcast_update;
   const PerfID _update_field_info;
+  const PerfID _swap_solution_values;
 };
 
 /**
@@ -12,6 +12,7 @@
 
 #include "EulerAngleProvider.h"
 #include "EBSDAccessFunctors.h"
+#include "NodeSharedArray.h"
 
 class EBSDReader;
 
@@ -33,6 +34,9 @@ InputParameters validParams<EBSDReader>();
  * Phases are referred to using the numbers in the EBSD data file. In case the phase number in the
  * data file
  * starts at 1 the phase 0 will simply contain no grains.
+ *
+ * The point data is stored once per compute node in shared memory, it is read by the first
+ * processor of each node.
  */
 class EBSDReader : public EulerAngleProvider, public EBSDAccessFunctors
 {
@@ -49,7 +53,7 @@ public:
   /**
    * Get the requested type of data at the point p.
    */
-  const EBSDPointData & getData(const Point & p) const;
+  EBSDPointData getData(const Point & p) const;
 
   /**
    * Get the requested type of average data for (global) grain number i.
@@ -108,16 +112,16 @@ public:
   getAvgDataAccessFunctor(const MooseEnum & field_name) const;
 
   /**
-   * Returns a map consisting of the node index followd by
-   * a vector of all grain weights for that node. Needed by ReconVarIC
+   * Returns the weights of all grains (getGrainNum() values) for a node, or nullptr if the node is
+   * not semilocal. Needed by PolycrystalEBSD
    */
-  const std::map<dof_id_type, std::vector<Real>> & getNodeToGrainWeightMap() const;
+  const Real * getNodeGrainWeights(dof_id_type node_id) const;
 
   /**
-   * Returns a map consisting of the node index followd by
-   * a vector of all phase weights for that node. Needed by ReconPhaseVarIC
+   * Returns the weights of all phases (getPhaseNum() values) for a node, or nullptr if the node is
+   * not semilocal. Needed by ReconPhaseVarIC
    */
-  const std::map<dof_id_type, std::vector<Real>> & getNodeToPhaseWeightMap() const;
+  const Real * getNodePhaseWeights(dof_id_type node_id) const;
 
   /// Maps need to be updated when the mesh changes
   void meshChanged();
@@ -139,7 +143,10 @@ protected:
   unsigned int _custom_columns;
 
   /// Logically three-dimensional data indexed by geometric points in a 1D vector
-  std::vector<EBSDPointData> _data;
+  NodeSharedArray<EBSDPointData> _data;
+
+  /// Custom data columns of each point in _data (_custom_columns values per point)
+  NodeSharedArray<Real> _custom_data;
 
   /// Averages by (global) grain ID
   std::vector<EBSDAvgData> _avg_data;
@@ -153,11 +160,14 @@ protected:
   /// global ID for given phases and grains
   std::vector<std::vector<unsigned int>> _global_id;
 
-  /// Map of grain weights per node
-  std::map<dof_id_type, std::vector<Real>> _node_to_grain_weight_map;
+  /// Sorted ids of the nodes with grain and phase weights
+  std::vector<dof_id_type> _weight_node_ids;
 
-  /// Map of phase weights per node
-  std::map<dof_id_type, std::vector<Real>> _node_to_phase_weight_map;
+  /// Grain weights of the nodes in _weight_node_ids (getGrainNum() values per node)
+  std::vector<Real> _node_grain_weights;
+
+  /// Phase weights of the nodes in _weight_node_ids (getPhaseNum() values per node)
+  std::vector<Real> _node_phase_weights;
 
   /// current timestep. Maps are only rebuild on mesh change during time step zero
   const int & _time_step;
@@ -185,6 +195,9 @@ protected:
 
   /// Build grain and phase weight maps
   void buildNodeWeightMaps();
+
+  /// Returns the position of a node in _weight_node_ids or _weight_node_ids.size() if not found
+  std::size_t weightIndex(dof_id_type node_id) const;
 };
 
 #endif // EBSDREADER_H
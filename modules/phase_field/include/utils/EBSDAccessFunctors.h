@@ -40,8 +40,8 @@ public:
     unsigned int _symmetry;
     ///@}
 
-    /// Custom data columns
-    std::vector<Real> _custom;
+    /// Custom data columns (points into the custom data storage of the EBSDReader)
+    const Real * _custom;
   };
 
   /// Averaged EBSD data
@@ -115,8 +115,7 @@ public:
     EBSDPointDataCustom(unsigned int index) : _index(index) {}
     virtual Real operator()(const EBSDPointData & d)
     {
-      mooseAssert(_index < d._custom.size(),
-                  "Requesting out of bounds index in EBSDPointDataCustom.");
+      mooseAssert(d._custom, "Requesting custom data from EBSDPointData without custom data.");
       return d._custom[_index];
     };
     const unsigned int _index;
@@ -0,0 +1,84 @@
+# Benchmark of the grain growth kernels on a synthetic Voronoi microstructure with many order
+# parameters, only a few of which are nonzero on any element. Newton with the full coupling
+# exercises the off-diagonal blocks of all the order parameters.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+  nz = 0
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 25
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    grain_num = 100
+    rand_seed = 105
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[Kernels]
+  [./PolycrystalKernel]
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./All]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./Copper]
+    type = GBEvolution
+    T = 500 # K
+    wGB = 60 # nm
+    GBmob0 = 2.5e-6 #m^4/(Js) from Schoenfelder 1997
+    Q = 0.23 #Migration energy in eV
+    GBenergy = 0.708 #GB energy in J/m^2
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = 'bdf2'
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  l_tol = 1.0e-4
+  l_max_its = 30
+  nl_max_its = 20
+  nl_rel_tol = 1.0e-9
+  num_steps = 3
+  dt = 80.0
+[]
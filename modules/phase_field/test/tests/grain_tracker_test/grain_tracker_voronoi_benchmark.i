@@ -0,0 +1,61 @@
+# Benchmark of the GrainTracker flood on a synthetic Voronoi microstructure. The order parameters
+# are only initialized and the grains tracked, no time step is taken.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 200
+  ny = 200
+  nz = 0
+  xmax = 1000
+  ymax = 1000
+  zmax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 12
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    grain_num = 200
+    rand_seed = 8675
+  [../]
+  [./grain_tracker]
+    type = GrainTracker
+    remap_grains = false
+    execute_on = 'initial'
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Steady
+[]
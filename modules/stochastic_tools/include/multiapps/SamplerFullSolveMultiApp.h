@@ -0,0 +1,70 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SAMPLERFULLSOLVEMULTIAPP_H
+#define SAMPLERFULLSOLVEMULTIAPP_H
+
+// MOOSE includes
+#include "FullSolveMultiApp.h"
+#include "MultiAppTransfer.h"
+#include "SamplerInterface.h"
+#include "Sampler.h"
+
+class SamplerFullSolveMultiApp;
+class StochasticToolsTransfer;
+
+template <>
+InputParameters validParams<SamplerFullSolveMultiApp>();
+
+/**
+ * A FullSolveMultiApp that operates on the rows of a Sampler.
+ *
+ * In 'normal' mode a sub-application is created for each row of each Sampler matrix. In 'batch'
+ * mode a single sub-application is created on each processor and it is re-used to solve each of
+ * the Sampler rows owned by the processor, the StochasticToolsTransfer objects for this MultiApp
+ * are executed for each row.
+ */
+class SamplerFullSolveMultiApp : public FullSolveMultiApp, public SamplerInterface
+{
+public:
+  SamplerFullSolveMultiApp(const InputParameters & parameters);
+
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+
+  /**
+   * Return the Sampler object for this MultiApp.
+   */
+  Sampler & getSampler() const { return _sampler; }
+
+  /**
+   * Return true when the sub-applications are re-used for each of the local Sampler rows.
+   */
+  bool isBatchMode() const { return _batch_mode; }
+
+protected:
+  /**
+   * Solve the pooled sub-application for each of the local Sampler rows.
+   */
+  bool solveStepBatch(Real dt, Real target_time, bool auto_advance);
+
+  /**
+   * Return the active StochasticToolsTransfer objects for this MultiApp.
+   * @param direction The direction of the transfers
+   */
+  std::vector<std::shared_ptr<StochasticToolsTransfer>>
+  getActiveStochasticToolsTransfers(MultiAppTransfer::DIRECTION direction);
+
+  /// Sampler to utilize for creating MultiApps
+  Sampler & _sampler;
+
+  /// Flag for re-using a sub-application for each local Sampler row
+  const bool _batch_mode;
+};
+
+#endif
@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef LATINHYPERCUBESAMPLER_H
+#define LATINHYPERCUBESAMPLER_H
+
+#include "Sampler.h"
+
+class LatinHypercubeSampler;
+
+template <>
+InputParameters validParams<LatinHypercubeSampler>();
+
+/**
+ * A class used to perform Latin hypercube sampling.
+ *
+ * The probability space of each distribution is divided into "n_samples" equal intervals and each
+ * interval is sampled exactly once. The interval assigned to each row is computed with a
+ * hash-based permutation, thus every row may be generated independently.
+ */
+class LatinHypercubeSampler : public Sampler
+{
+public:
+  LatinHypercubeSampler(const InputParameters & parameters);
+
+protected:
+  virtual void computeSampleRow(unsigned int global_index, std::vector<Real> & data) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
+
+  /**
+   * Return the position of the given index within a pseudo-random permutation.
+   * @param index The index to permute, must be less than size
+   * @param size The number of items in the permutation
+   * @param seed The seed that selects the permutation
+   *
+   * This is the permutation of A. Kensler, "Correlated Multi-Jittered Sampling", Pixar Technical
+   * Memo 13-01, 2013.
+   */
+  static uint32_t permute(uint32_t index, uint32_t size, uint32_t seed);
+
+  /// Number of samples to create for each distribution
+  const std::size_t _num_samples;
+};
+
+#endif /* LATINHYPERCUBESAMPLER_H */
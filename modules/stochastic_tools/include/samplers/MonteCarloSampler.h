@@ -26,6 +26,8 @@ public:
 
 protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
+  virtual void computeSampleRow(unsigned int global_index, std::vector<Real> & data) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
 
   /// Number of monte carlo samples to create for each distribution
   const std::size_t _num_samples;
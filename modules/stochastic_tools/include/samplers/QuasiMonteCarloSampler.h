@@ -0,0 +1,75 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef QUASIMONTECARLOSAMPLER_H
+#define QUASIMONTECARLOSAMPLER_H
+
+#include "Sampler.h"
+
+#include <array>
+
+class QuasiMonteCarloSampler;
+
+template <>
+InputParameters validParams<QuasiMonteCarloSampler>();
+
+/**
+ * A class used to perform quasi-Monte Carlo sampling with the Sobol or Halton low-discrepancy
+ * sequences, which may be randomized by scrambling.
+ *
+ * Each row is an element of the sequence, thus every row may be generated independently.
+ */
+class QuasiMonteCarloSampler : public Sampler
+{
+public:
+  QuasiMonteCarloSampler(const InputParameters & parameters);
+
+protected:
+  virtual void computeSampleRow(unsigned int global_index, std::vector<Real> & data) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
+
+  /**
+   * Return the value of the Sobol sequence in the unit interval.
+   * @param index The index of the element in the sequence
+   * @param dim The dimension (i.e., the distribution index)
+   */
+  Real sobol(unsigned int index, unsigned int dim) const;
+
+  /**
+   * Return the value of the Halton sequence in the unit interval.
+   * @param index The index of the element in the sequence
+   * @param dim The dimension (i.e., the distribution index)
+   */
+  Real halton(unsigned int index, unsigned int dim) const;
+
+  /**
+   * Return an uniformly distributed 32-bit integer from the counter-based generator, which is the
+   * same for all rows.
+   * @param dim The dimension (i.e., the distribution index)
+   * @param key Additional key for producing independent values for a dimension
+   */
+  uint32_t scrambleSeed(unsigned int dim, unsigned int key) const;
+
+  /// Number of samples to create for each distribution
+  const std::size_t _num_samples;
+
+  /// Flag for using the Halton sequence rather than the Sobol sequence
+  const bool _use_halton;
+
+  /// Flag for randomizing the sequence
+  const bool _scramble;
+
+  /// Sobol direction numbers for each dimension
+  std::vector<std::array<uint32_t, 32>> _directions;
+
+  /// Prime base of the Halton sequence for each dimension
+  std::vector<unsigned int> _bases;
+};
+
+#endif /* QUASIMONTECARLOSAMPLER_H */
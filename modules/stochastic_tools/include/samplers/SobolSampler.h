@@ -28,6 +28,8 @@ protected:
   virtual std::vector<DenseMatrix<Real>> sample() override;
   virtual void sampleSetUp() override;
   virtual void sampleTearDown() override;
+  virtual void computeSampleRow(unsigned int global_index, std::vector<Real> & data) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
 
   /// Number of Monte Carlo samples to create for each Sobol matrix
   const std::size_t _num_samples;
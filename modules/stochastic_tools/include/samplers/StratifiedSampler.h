@@ -0,0 +1,45 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef STRATIFIEDSAMPLER_H
+#define STRATIFIEDSAMPLER_H
+
+#include "Sampler.h"
+
+class StratifiedSampler;
+
+template <>
+InputParameters validParams<StratifiedSampler>();
+
+/**
+ * A class used to perform stratified sampling.
+ *
+ * The probability space of each distribution is divided into equal intervals, the strata are the
+ * tensor product of these intervals and each stratum is sampled the same number of times.
+ */
+class StratifiedSampler : public Sampler
+{
+public:
+  StratifiedSampler(const InputParameters & parameters);
+
+protected:
+  virtual void computeSampleRow(unsigned int global_index, std::vector<Real> & data) override;
+  virtual std::vector<unsigned int> sampleRowCounts() override;
+
+  /// Number of intervals for each distribution
+  const std::vector<unsigned int> & _num_intervals;
+
+  /// Number of samples to create in each stratum
+  const unsigned int _samples_per_stratum;
+
+  /// Total number of samples
+  std::size_t _num_samples;
+};
+
+#endif /* STRATIFIEDSAMPLER_H */
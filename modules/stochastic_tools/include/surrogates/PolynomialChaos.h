@@ -0,0 +1,87 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef POLYNOMIALCHAOS_H
+#define POLYNOMIALCHAOS_H
+
+#include "SurrogateModel.h"
+#include "SamplerInterface.h"
+#include "DistributionInterface.h"
+
+class PolynomialChaos;
+class Sampler;
+class Distribution;
+
+template <>
+InputParameters validParams<PolynomialChaos>();
+
+/**
+ * Polynomial chaos expansion surrogate trained by least-squares regression.
+ *
+ * Each input is mapped to the interval [-1, 1] using the cumulative distribution function of the
+ * associated distribution, where the mapped inputs are uniformly distributed. The expansion is a
+ * sum of the products of Legendre polynomials of the mapped inputs with a total order up to the
+ * "order" parameter. The coefficients are computed by least squares from the training samples,
+ * the normal equations are assembled from the local Sampler rows and summed across processors.
+ */
+class PolynomialChaos : public SurrogateModel, SamplerInterface, DistributionInterface
+{
+public:
+  PolynomialChaos(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+  virtual Real evaluate(const std::vector<Real> & x) const override;
+
+  /**
+   * The mean of the response, which is the coefficient of the constant term.
+   */
+  Real computeMean() const;
+
+  /**
+   * The standard deviation of the response computed from the coefficients.
+   */
+  Real computeStandardDeviation() const;
+
+protected:
+  /**
+   * Evaluate each of the polynomial terms.
+   * @param x The input values, one for each distribution
+   * @param terms The storage for the values of the terms
+   */
+  void evaluateTerms(const std::vector<Real> & x, std::vector<Real> & terms) const;
+
+  /// The Sampler that created the training samples
+  Sampler & _sampler;
+
+  /// The training results, one value for each row of the Sampler
+  const VectorPostprocessorValue & _values;
+
+  /// Maximum total order of the polynomials
+  const unsigned int _order;
+
+  /// The distributions of the inputs, from the Sampler
+  std::vector<Distribution *> _distributions;
+
+  /// The polynomial order for each input of each term
+  std::vector<std::vector<unsigned int>> _multi_indices;
+
+  /// The expansion coefficients
+  std::vector<Real> _coefficients;
+
+  ///@{
+  /// Normal equations for the least-squares regression
+  DenseMatrix<Real> _matrix;
+  DenseVector<Real> _rhs;
+  ///@}
+};
+
+#endif
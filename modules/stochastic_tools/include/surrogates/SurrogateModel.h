@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SURROGATEMODEL_H
+#define SURROGATEMODEL_H
+
+#include "GeneralUserObject.h"
+
+class SurrogateModel;
+
+template <>
+InputParameters validParams<SurrogateModel>();
+
+/**
+ * Base class for surrogate models, which are trained from the results of sub-application solves
+ * and provide an inexpensive approximation of the response for a set of sampled input values.
+ */
+class SurrogateModel : public GeneralUserObject
+{
+public:
+  SurrogateModel(const InputParameters & parameters);
+
+  /**
+   * Evaluate the surrogate model.
+   * @param x The input values, one for each distribution (i.e., a row of a Sampler matrix)
+   * @return The approximate response for the given input
+   */
+  virtual Real evaluate(const std::vector<Real> & x) const = 0;
+};
+
+#endif
@@ -11,38 +11,60 @@
 #define SAMPLERPOSTPROCESSORTRANSFER_H
 
 // MOOSE includes
-#include "MultiAppVectorPostprocessorTransfer.h"
+#include "StochasticToolsTransfer.h"
 #include "Sampler.h"
 
 // Forward declarations
 class SamplerPostprocessorTransfer;
-class SamplerReceiver;
-class SamplerMultiApp;
 class StochasticResults;
 
 template <>
 InputParameters validParams<SamplerPostprocessorTransfer>();
 
 /**
- * Transfer Postprocessor from sub-applications to the master application.
+ * Transfer Postprocessor and VectorPostprocessor data from sub-applications to the master
+ * application.
+ *
+ * The values for all of the samples handled by this processor are packed into a single buffer,
+ * which is communicated with a single collective operation when the transfer is finalized.
  */
-class SamplerPostprocessorTransfer : public MultiAppVectorPostprocessorTransfer
+class SamplerPostprocessorTransfer : public StochasticToolsTransfer
 {
 public:
   SamplerPostprocessorTransfer(const InputParameters & parameters);
   virtual void initialSetup() override;
 
-protected:
+  virtual void initializeFromMultiapp() override;
   virtual void executeFromMultiapp() override;
+  virtual void finalizeFromMultiapp() override;
+
+protected:
+  /// Names of the Postprocessors on the sub-applications
+  std::vector<PostprocessorName> _sub_pp_names;
 
-  /// SamplerMultiApp that this transfer is working with
-  SamplerMultiApp * _sampler_multi_app;
+  ///@{
+  /// Names of the VectorPostprocessors and vectors on the sub-applications
+  std::vector<VectorPostprocessorName> _sub_vpp_names;
+  std::vector<std::string> _sub_vector_names;
+  ///@}
 
-  /// Sampler object that is retrieved from the SamplerMultiApp
-  Sampler & _sampler;
+  /// Name of the StochasticResults object on the master application
+  const VectorPostprocessorName & _master_vpp_name;
+
+  /// Name of the StochasticResults object on the master application receiving the vectors
+  const VectorPostprocessorName _vector_storage_name;
 
   /// Storage for StochasticResults object that data will be transferred to/from
   StochasticResults * _results;
+
+  /// Storage for StochasticResults object that the vectors will be transferred to
+  StochasticResults * _vector_results;
+
+  /**
+   * Packed data collected on this processor, for each sample this contains the global Sampler row
+   * followed by the Postprocessor values and then the size and values of each vector.
+   */
+  std::vector<Real> _local_data;
 };
 
 #endif
@@ -11,7 +11,7 @@
 #define SAMPLERTRANSFER_H
 
 // MOOSE includes
-#include "MultiAppTransfer.h"
+#include "StochasticToolsTransfer.h"
 #include "Sampler.h"
 
 // Forward declarations
@@ -24,11 +24,14 @@ InputParameters validParams<SamplerTransfer>();
 /**
  * Copy each row from each DenseMatrix to the sub-applications SamplerReceiver object.
  */
-class SamplerTransfer : public MultiAppTransfer
+class SamplerTransfer : public StochasticToolsTransfer
 {
 public:
   SamplerTransfer(const InputParameters & parameters);
-  virtual void execute() override;
+
+  virtual void initializeToMultiapp() override;
+  virtual void executeToMultiapp() override;
+  virtual void finalizeToMultiapp() override;
 
 protected:
   /**
@@ -40,14 +43,14 @@ protected:
   /// Storage for the list of parameters to control
   const std::vector<std::string> & _parameter_names;
 
-  /// Pointer to the Sampler object used by the SamplerMultiApp
-  Sampler * _sampler_ptr;
-
   /// The name of the SamplerReceiver Control object on the sub-application
   const std::string & _receiver_name;
 
-  /// The matrix and row for each MultiApp
-  std::vector<std::pair<unsigned int, unsigned int>> _multi_app_matrix_row;
+  /// The Sampler data for the rows operated on by this processor
+  DenseMatrix<Real> _samples;
+
+  /// The global row index of the first row in _samples
+  unsigned int _first_row;
 };
 
 #endif
@@ -0,0 +1,79 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef STOCHASTICTOOLSTRANSFER_H
+#define STOCHASTICTOOLSTRANSFER_H
+
+// MOOSE includes
+#include "MultiAppTransfer.h"
+
+// Forward declarations
+class StochasticToolsTransfer;
+class Sampler;
+
+template <>
+InputParameters validParams<StochasticToolsTransfer>();
+
+/**
+ * Base class for Transfers that operate with a SamplerMultiApp or SamplerFullSolveMultiApp.
+ *
+ * The transfer is separated into initialize, execute, and finalize methods; the execute methods
+ * operate on a single sub-application and Sampler row. This allows the SamplerFullSolveMultiApp
+ * in batch mode to perform the transfers for each sample that is solved with the pooled
+ * sub-application.
+ */
+class StochasticToolsTransfer : public MultiAppTransfer
+{
+public:
+  StochasticToolsTransfer(const InputParameters & parameters);
+
+  /**
+   * Perform the transfer for all of the local sub-applications. This does nothing when the
+   * SamplerFullSolveMultiApp is operating in batch mode, in that case the MultiApp calls the
+   * methods below directly.
+   */
+  virtual void execute() override;
+
+  ///@{
+  /**
+   * Methods for transferring data to/from the sub-applications. The initialize and finalize
+   * methods are called once per execution and the execute methods are called for each
+   * sub-application, see setGlobalIndices.
+   */
+  virtual void initializeToMultiapp() {}
+  virtual void executeToMultiapp() {}
+  virtual void finalizeToMultiapp() {}
+
+  virtual void initializeFromMultiapp() {}
+  virtual void executeFromMultiapp() {}
+  virtual void finalizeFromMultiapp() {}
+  ///@}
+
+  /**
+   * Set the sub-application and Sampler row that the execute methods operate on.
+   * @param app_index The global sub-application index
+   * @param row_index The global Sampler row index (see Sampler::getLocation)
+   */
+  void setGlobalIndices(unsigned int app_index, unsigned int row_index);
+
+protected:
+  /// Pointer to the Sampler object used by the MultiApp
+  Sampler * _sampler_ptr;
+
+  /// Flag indicating that the MultiApp calls the transfer methods for each sample
+  bool _batch_mode;
+
+  /// The global sub-application index for the execute methods
+  unsigned int _app_index;
+
+  /// The global Sampler row for the execute methods
+  unsigned int _row_index;
+};
+
+#endif
@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EVALUATESURROGATE_H
+#define EVALUATESURROGATE_H
+
+// MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+#include "SamplerInterface.h"
+
+class EvaluateSurrogate;
+class SurrogateModel;
+
+template <>
+InputParameters validParams<EvaluateSurrogate>();
+
+/**
+ * A tool for evaluating a SurrogateModel for each row of a Sampler, in place of sub-application
+ * solves.
+ */
+class EvaluateSurrogate : public GeneralVectorPostprocessor, SamplerInterface
+{
+public:
+  EvaluateSurrogate(const InputParameters & parameters);
+  void virtual initialize() override;
+  void virtual execute() override;
+  void virtual finalize() override;
+
+protected:
+  /// Storage for declared vectors, one for each Sampler matrix
+  std::vector<VectorPostprocessorValue *> _sample_vectors;
+
+  /// The sampler that provides the inputs
+  Sampler & _sampler;
+
+  /// The surrogate model to evaluate
+  const SurrogateModel & _model;
+
+  /// The values for the Sampler rows owned by this processor
+  std::vector<Real> _local_values;
+};
+
+#endif
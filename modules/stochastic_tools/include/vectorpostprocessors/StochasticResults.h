@@ -33,17 +33,31 @@ public:
   /**
    * Initialize storage based on the Sampler returned by the SamplerMultiApp.
    * @param sampler The Sampler associated with the MultiApp that this VPP is working with.
+   * @param quantities The names of the quantities collected for each sample, a vector named
+   *                   "<sample>_<quantity>" is declared for each Sampler matrix and quantity. If
+   *                   empty a single quantity is assumed and the vectors are named "<sample>".
    *
    * This method is called by the SamplerPostprocessorTransfer.
    */
-  void init(Sampler & _sampler);
+  void init(Sampler & sampler,
+            const std::vector<std::string> & quantities = std::vector<std::string>());
 
   /**
    * Return the VectorPostprocessorValue for a given Sampler group index.
    * @param group Index related to the index of the DenseMatrix returned by Sampler::getSamples()
+   * @param quantity Index of the quantity supplied to init()
    * @return A reference to the storage location for the PP data from the sub-applications.
    */
-  VectorPostprocessorValue & getVectorPostprocessorValueByGroup(unsigned int group);
+  VectorPostprocessorValue & getVectorPostprocessorValueByGroup(unsigned int group,
+                                                                unsigned int quantity = 0);
+
+  /**
+   * Append the rows of the vectors that have not been written in the current time step to the
+   * column files, this does nothing if the 'append_file_base' parameter is not supplied.
+   *
+   * This method is called by the SamplerPostprocessorTransfer after the data is collected.
+   */
+  void appendToFiles();
 
   /**
    * Get the sample vectors
@@ -60,6 +74,27 @@ protected:
 
   /// The sampler to extract data
   Sampler * _sampler = nullptr;
+
+  /// Number of quantities stored for each Sampler matrix
+  unsigned int _num_quantities = 1;
+
+  /// Names of the declared vectors, which are used to build the column file names
+  std::vector<std::string> _vector_names;
+
+  /// Return the name of the column file for the vector with the supplied index
+  std::string appendFileName(std::size_t index) const;
+
+  /// Base name for the column files, empty when files are not written
+  const std::string _append_file_base;
+
+  /// Extension of the column files, which selects their format
+  const std::string _append_file_ext;
+
+  /// Number of rows of each vector appended to the column files in the current time step
+  std::vector<std::size_t> _rows_written;
+
+  /// The time step of the rows counted in _rows_written
+  int _append_t_step;
 };
 
 #endif
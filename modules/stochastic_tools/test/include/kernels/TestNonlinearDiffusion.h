@@ -0,0 +1,39 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef TESTNONLINEARDIFFUSION_H
+#define TESTNONLINEARDIFFUSION_H
+
+#include "Kernel.h"
+
+class TestNonlinearDiffusion;
+
+template <>
+InputParameters validParams<TestNonlinearDiffusion>();
+
+/**
+ * Diffusion with the coefficient 1 + c * u^2, which provides a sub-application whose response is
+ * nonlinear in the sampled parameters.
+ *
+ * WARNING! This object is only for testing and should not be used in general.
+ */
+class TestNonlinearDiffusion : public Kernel
+{
+public:
+  TestNonlinearDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  /// The controllable coefficient of the nonlinear part of the diffusivity
+  const Real & _coefficient;
+};
+
+#endif
@@ -0,0 +1,78 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_right]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 5
+    distributions = 'uniform_left uniform_right'
+    counter_based_rng = true
+    execute_on = INITIAL # create random numbers on initial and use them for each timestep
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = SamplerFullSolveMultiApp
+    input_files = sub.i
+    sampler = sample
+    mode = batch
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./runner]
+    type = SamplerTransfer
+    multi_app = sub
+    parameters = 'BCs/left/value BCs/right/value'
+    to_control = 'stochastic'
+  [../]
+  [./data]
+    type = SamplerPostprocessorTransfer
+    multi_app = sub
+    vector_postprocessor = storage
+    postprocessor = avg
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./storage]
+    type = StochasticResults
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,70 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_abs_tol = 1e-12
+[]
+
+[Controls]
+  [./stochastic]
+    type = SamplerReceiver
+  [../]
+[]
+
+[Postprocessors]
+  [./avg]
+    type = AverageNodalVariableValue
+    variable = u
+  [../]
+  [./left_value]
+    type = PointValue
+    variable = u
+    point = '0 0 0'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./line]
+    type = LineValueSampler
+    variable = u
+    start_point = '0 0 0'
+    end_point = '1 0 0'
+    num_points = 3
+    sort_by = x
+  [../]
+[]
+
+[Outputs]
+[]
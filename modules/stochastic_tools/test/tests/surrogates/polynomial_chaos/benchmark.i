@@ -0,0 +1,180 @@
+# Compares the wall time and accuracy of evaluating a polynomial chaos surrogate against
+# performing a full solve of the sub-application for each sample. The timing for the
+# "reference" MultiApp and the "surrogate" VectorPostprocessor are reported by the PerfGraph.
+#
+# The sub-application solves nonlinear diffusion with a sampled coefficient, so its response is
+# nonlinear in the sampled parameters and depends on the state of the sub-application:
+# - "batch_accurate" is one when the solves of the sub-application restored in place for each
+#   sample match the solves of a sub-application re-created for each sample, and
+# - "surrogate_accurate" is one when the second order surrogate matches the solves within the
+#   error of truncating the expansion, which is about 1e-2 for this response.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_coefficient]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  [./train]
+    type = LatinHypercubeSampler
+    n_samples = 20
+    distributions = 'uniform_left uniform_coefficient'
+    execute_on = INITIAL
+  [../]
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 200
+    counter_based_rng = true
+    distributions = 'uniform_left uniform_coefficient'
+    execute_on = INITIAL
+  [../]
+[]
+
+[MultiApps]
+  [./train]
+    type = SamplerFullSolveMultiApp
+    input_files = benchmark_sub.i
+    sampler = train
+    mode = batch
+    execute_on = INITIAL
+  [../]
+  [./reference]
+    type = SamplerFullSolveMultiApp
+    input_files = benchmark_sub.i
+    sampler = sample
+    mode = batch
+    execute_on = INITIAL
+  [../]
+  [./recreate]
+    type = SamplerFullSolveMultiApp
+    input_files = benchmark_sub.i
+    sampler = sample
+    mode = batch
+    reset_in_place = false
+    execute_on = INITIAL
+  [../]
+[]
+
+[Transfers]
+  [./train_runner]
+    type = SamplerTransfer
+    multi_app = train
+    parameters = 'BCs/left/value Kernels/diff/coefficient'
+    to_control = 'stochastic'
+  [../]
+  [./train_data]
+    type = SamplerPostprocessorTransfer
+    multi_app = train
+    vector_postprocessor = train_storage
+    postprocessor = avg
+  [../]
+  [./reference_runner]
+    type = SamplerTransfer
+    multi_app = reference
+    parameters = 'BCs/left/value Kernels/diff/coefficient'
+    to_control = 'stochastic'
+  [../]
+  [./reference_data]
+    type = SamplerPostprocessorTransfer
+    multi_app = reference
+    vector_postprocessor = reference_storage
+    postprocessor = avg
+  [../]
+  [./recreate_runner]
+    type = SamplerTransfer
+    multi_app = recreate
+    parameters = 'BCs/left/value Kernels/diff/coefficient'
+    to_control = 'stochastic'
+  [../]
+  [./recreate_data]
+    type = SamplerPostprocessorTransfer
+    multi_app = recreate
+    vector_postprocessor = recreate_storage
+    postprocessor = avg
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./train_storage]
+    type = StochasticResults
+  [../]
+  [./reference_storage]
+    type = StochasticResults
+  [../]
+  [./recreate_storage]
+    type = StochasticResults
+  [../]
+  [./surrogate]
+    type = EvaluateSurrogate
+    sampler = sample
+    model = pc
+  [../]
+[]
+
+[UserObjects]
+  [./pc]
+    type = PolynomialChaos
+    sampler = train
+    results_vpp = train_storage
+    order = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./batch_accurate]
+    type = VectorPostprocessorComparison
+    vectorpostprocessor_a = reference_storage
+    vector_name_a = sample_0
+    vectorpostprocessor_b = recreate_storage
+    vector_name_b = sample_0
+    comparison_type = equals
+    absolute_tolerance = 1e-8
+  [../]
+  [./surrogate_accurate]
+    type = VectorPostprocessorComparison
+    vectorpostprocessor_a = surrogate
+    vector_name_a = sample_0
+    vectorpostprocessor_b = reference_storage
+    vector_name_b = sample_0
+    comparison_type = equals
+    absolute_tolerance = 5e-2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  perf_graph = true
+  [./out]
+    type = CSV
+    file_base = benchmark_out
+    show = 'batch_accurate surrogate_accurate'
+  [../]
+[]
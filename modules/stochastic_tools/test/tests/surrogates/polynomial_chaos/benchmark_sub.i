@@ -0,0 +1,56 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 100
+  ny = 100
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = TestNonlinearDiffusion
+    variable = u
+    coefficient = 1
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_abs_tol = 1e-12
+[]
+
+[Controls]
+  [./stochastic]
+    type = SamplerReceiver
+  [../]
+[]
+
+[Postprocessors]
+  [./avg]
+    type = AverageNodalVariableValue
+    variable = u
+  [../]
+[]
+
+[Outputs]
+[]
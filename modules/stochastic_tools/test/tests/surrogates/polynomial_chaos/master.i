@@ -0,0 +1,103 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Distributions]
+  [./uniform_left]
+    type = UniformDistribution
+    lower_bound = 0
+    upper_bound = 0.5
+  [../]
+  [./uniform_right]
+    type = UniformDistribution
+    lower_bound = 1
+    upper_bound = 2
+  [../]
+[]
+
+[Samplers]
+  # Samples solved with the sub-application to train the surrogate
+  [./train]
+    type = LatinHypercubeSampler
+    n_samples = 10
+    distributions = 'uniform_left uniform_right'
+    execute_on = INITIAL
+  [../]
+
+  # Samples evaluated with the surrogate
+  [./sample]
+    type = MonteCarloSampler
+    n_samples = 5
+    seed = 2011
+    counter_based_rng = true
+    distributions = 'uniform_left uniform_right'
+    execute_on = INITIAL
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = SamplerFullSolveMultiApp
+    input_files = sub.i
+    sampler = train
+    mode = batch
+    execute_on = INITIAL
+  [../]
+[]
+
+[Transfers]
+  [./runner]
+    type = SamplerTransfer
+    multi_app = sub
+    parameters = 'BCs/left/value BCs/right/value'
+    to_control = 'stochastic'
+  [../]
+  [./data]
+    type = SamplerPostprocessorTransfer
+    multi_app = sub
+    vector_postprocessor = storage
+    postprocessor = avg
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./storage]
+    type = StochasticResults
+    outputs = none
+  [../]
+  [./surrogate]
+    type = EvaluateSurrogate
+    sampler = sample
+    model = pc
+  [../]
+[]
+
+[UserObjects]
+  [./pc]
+    type = PolynomialChaos
+    sampler = train
+    results_vpp = storage
+    order = 2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,54 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_abs_tol = 1e-12
+[]
+
+[Controls]
+  [./stochastic]
+    type = SamplerReceiver
+  [../]
+[]
+
+[Postprocessors]
+  [./avg]
+    type = AverageNodalVariableValue
+    variable = u
+  [../]
+[]
+
+[Outputs]
+[]
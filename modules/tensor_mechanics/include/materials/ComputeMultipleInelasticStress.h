@@ -155,6 +155,9 @@ protected:
   /// the consistent tangent operators computed by each plastic model
   std::vector<RankFourTensor> _consistent_tangent_operator;
 
+  /// the inelastic strain increment of each model, stored to avoid allocating it at every qp
+  std::vector<RankTwoTensor> _inelastic_strain_increment;
+
   /// whether to cycle through the models, using only one model per timestep
   const bool _cycle_models;
 
@@ -67,6 +67,12 @@ protected:
 
   /// Exponential calculated from current time
   Real _exp_time;
+
+  ///@{
+  /// Stress difference and its power of the last residual evaluation
+  Real _residual_stress_delta;
+  Real _residual_stress_delta_power;
+  ///@}
 };
 
 template <>
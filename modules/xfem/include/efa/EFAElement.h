@@ -16,6 +16,7 @@
 #include <ostream>
 
 class EFANode;
+class EFAInverseConnectivity;
 
 class EFAElement
 {
@@ -60,7 +61,7 @@ public:
   unsigned int numChildren() const;
   void addChild(EFAElement * child);
   void clearParentAndChildren();
-  void findGeneralNeighbors(std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivity);
+  void findGeneralNeighbors(EFAInverseConnectivity & InverseConnectivity);
   EFAElement * getGeneralNeighbor(unsigned int index) const;
   unsigned int numGeneralNeighbors() const;
 
@@ -79,8 +80,7 @@ public:
 
   virtual unsigned int getNeighborIndex(const EFAElement * neighbor_elem) const = 0;
   virtual void clearNeighbors() = 0;
-  virtual void
-  setupNeighbors(std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivityMap) = 0;
+  virtual void setupNeighbors(EFAInverseConnectivity & InverseConnectivityMap) = 0;
   virtual void neighborSanityCheck() const = 0;
 
   virtual void initCrackTip(std::set<EFAElement *> & CrackTipElements) = 0;
@@ -109,7 +109,7 @@ public:
   virtual void
   connectNeighbors(std::map<unsigned int, EFANode *> & PermanentNodes,
                    std::map<unsigned int, EFANode *> & TempNodes,
-                   std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivityMap,
+                   EFAInverseConnectivity & InverseConnectivityMap,
                    bool merge_phantom_edges) = 0;
   virtual void printElement(std::ostream & ostream) = 0;
 
@@ -52,7 +52,7 @@ public:
   bool overlaysElement(const EFAElement2D * other_elem) const;
   virtual unsigned int getNeighborIndex(const EFAElement * neighbor_elem) const;
   virtual void clearNeighbors();
-  virtual void setupNeighbors(std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivityMap);
+  virtual void setupNeighbors(EFAInverseConnectivity & InverseConnectivityMap);
   virtual void neighborSanityCheck() const;
 
   virtual void initCrackTip(std::set<EFAElement *> & CrackTipElements);
@@ -80,7 +80,7 @@ public:
   virtual void
   connectNeighbors(std::map<unsigned int, EFANode *> & PermanentNodes,
                    std::map<unsigned int, EFANode *> & TempNodes,
-                   std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivityMap,
+                   EFAInverseConnectivity & InverseConnectivityMap,
                    bool merge_phantom_edges);
   virtual void printElement(std::ostream & ostream);
 
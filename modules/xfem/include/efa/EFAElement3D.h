@@ -60,7 +60,7 @@ public:
                                     unsigned int & neigh_face_id,
                                     unsigned int & neigh_edge_id) const;
   virtual void clearNeighbors();
-  virtual void setupNeighbors(std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivityMap);
+  virtual void setupNeighbors(EFAInverseConnectivity & InverseConnectivityMap);
   virtual void neighborSanityCheck() const;
 
   virtual void initCrackTip(std::set<EFAElement *> & CrackTipElements);
@@ -88,7 +88,7 @@ public:
   virtual void
   connectNeighbors(std::map<unsigned int, EFANode *> & PermanentNodes,
                    std::map<unsigned int, EFANode *> & TempNodes,
-                   std::map<EFANode *, std::set<EFAElement *>> & InverseConnectivityMap,
+                   EFAInverseConnectivity & InverseConnectivityMap,
                    bool merge_phantom_faces);
   virtual void printElement(std::ostream & ostream);
 
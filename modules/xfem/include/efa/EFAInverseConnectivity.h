@@ -0,0 +1,61 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EFAINVERSECONNECTIVITY_H
+#define EFAINVERSECONNECTIVITY_H
+
+#include <utility>
+#include <vector>
+
+class EFANode;
+class EFAElement;
+
+/**
+ * The elements connected to each node, stored in compressed (CSR) form: a sorted array of nodes,
+ * an array of offsets and one array of elements. The elements of each node are sorted and unique.
+ * Insertions are buffered and merged into the arrays on the next query.
+ */
+class EFAInverseConnectivity
+{
+public:
+  typedef std::vector<EFAElement *>::const_iterator const_iterator;
+
+  /// The elements connected to a node
+  class ElementRange
+  {
+  public:
+    ElementRange(const_iterator begin, const_iterator end) : _begin(begin), _end(end) {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+
+  private:
+    const_iterator _begin;
+    const_iterator _end;
+  };
+
+  EFAInverseConnectivity();
+
+  void clear();
+  void insert(EFANode * node, EFAElement * elem);
+  ElementRange elements(EFANode * node);
+
+private:
+  /// Merges the pending insertions into the compressed arrays
+  void update();
+
+  std::vector<EFANode *> _nodes;
+  std::vector<std::size_t> _offsets;
+  std::vector<EFAElement *> _elements;
+  std::vector<std::pair<EFANode *, EFAElement *>> _pending;
+};
+
+#endif // EFAINVERSECONNECTIVITY_H
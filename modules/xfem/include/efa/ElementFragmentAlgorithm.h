@@ -16,6 +16,7 @@
 
 #include "EFANode.h"
 #include "EFAElement.h"
+#include "EFAInverseConnectivity.h"
 
 class ElementFragmentAlgorithm
 {
@@ -41,7 +42,7 @@ private:
   std::vector<EFANode *> _deleted_nodes;
   std::vector<EFAElement *> _child_elements;
   std::vector<EFAElement *> _parent_elements;
-  std::map<EFANode *, std::set<EFAElement *>> _inverse_connectivity;
+  EFAInverseConnectivity _inverse_connectivity;
 
 public:
   unsigned int add2DElements(std::vector<std::vector<unsigned int>> & quads);
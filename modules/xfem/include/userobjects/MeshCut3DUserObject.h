@@ -11,8 +11,10 @@
 #define MESH_CUT_3D_USEROBJECT_H
 
 #include "GeometricCutUserObject.h"
+#include "BoundingBoxTree.h"
 
 #include <array>
+#include <unordered_set>
 
 class MeshCut3DUserObject;
 class Function;
@@ -97,6 +99,20 @@ protected:
   /// New boundary after growth
   std::vector<std::vector<dof_id_type>> _front;
 
+  /// Bounding boxes of the cutter mesh elements, used to find the elements that may cut an edge
+  BoundingBoxTree _cut_elem_tree;
+
+  /// The cutter mesh elements in the order of their boxes in _cut_elem_tree
+  std::vector<const Elem *> _cut_elems;
+
+  /// The ids of the cutter mesh elements in _cut_elem_tree
+  std::unordered_set<dof_id_type> _cut_elem_ids;
+
+  /**
+    Add the boxes of the cutter mesh elements created since the last call to the tree
+   */
+  void updateCutElemTree();
+
   /**
     Check if a line intersects with an element
    */
@@ -142,6 +142,8 @@ class TestHarness:
             checks['unique_ids'] = set(['ALL'])
             checks['vtk'] = set(['ALL'])
             checks['tecplot'] = set(['ALL'])
+            checks['hdf5'] = set(['ALL'])
+            checks['hdf5_parallel'] = set(['ALL'])
             checks['dof_id_bytes'] = set(['ALL'])
             checks['petsc_debug'] = set(['ALL'])
             checks['curl'] = set(['ALL'])
@@ -168,6 +170,8 @@ class TestHarness:
             checks['unique_ids'] = util.getLibMeshConfigOption(self.libmesh_dir, 'unique_ids')
             checks['vtk'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'vtk')
             checks['tecplot'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'tecplot')
+            checks['hdf5'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'hdf5')
+            checks['hdf5_parallel'] = util.getHDF5ParallelOption()
             checks['dof_id_bytes'] = util.getLibMeshConfigOption(self.libmesh_dir, 'dof_id_bytes')
             checks['petsc_debug'] = util.getLibMeshConfigOption(self.libmesh_dir, 'petsc_debug')
             checks['curl'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'curl')
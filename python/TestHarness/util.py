@@ -65,6 +65,14 @@ LIBMESH_OPTIONS = {
       'FALSE' : '0'
       }
                      },
+  'hdf5' :         { 're_option' : r'#define\s+LIBMESH_HAVE_HDF5\s+(\d+)',
+                     'default'   : 'FALSE',
+                     'options'   :
+                       {
+      'TRUE'  : '1',
+      'FALSE' : '0'
+      }
+                     },
   'petsc_major' :  { 're_option' : r'#define\s+LIBMESH_DETECTED_PETSC_VERSION_MAJOR\s+(\d+)',
                      'default'   : '1'
                    },
@@ -563,6 +571,18 @@ def getLibMeshConfigOption(libmesh_dir, option):
 
     return option_set
 
+def getHDF5ParallelOption():
+    # XDMF output in parallel requires an HDF5 library built with parallel support, which is not
+    # recorded in the libMesh configuration. The HDF5 compiler wrappers report it.
+    option_set = set(['ALL'])
+    for wrapper in ['h5pcc', 'h5cc']:
+        m = re.search(r'Parallel HDF5:\s*(yes|no)', runCommand(wrapper + ' -showconfig'))
+        if m != None:
+            option_set.add('TRUE' if m.group(1) == 'yes' else 'FALSE')
+            return option_set
+    option_set.add('FALSE')
+    return option_set
+
 def getSharedOption(libmesh_dir):
     # Some tests may only run properly with shared libraries on/off
     # We need to detect this condition
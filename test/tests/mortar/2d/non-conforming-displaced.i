@@ -0,0 +1,101 @@
+# The upper block slides along the interface, its ends stay in place, so the mortar quadrature
+# points are paired with different master faces at every time step
+[Mesh]
+  file = non-conf-coarse.e
+  displacements = 'disp_x disp_y'
+
+  [./MortarInterfaces]
+    [./middle]
+      master = 100
+      slave = 101
+      subdomain = 1000
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./exact_sln]
+    type = ParsedFunction
+    value = x+y
+  [../]
+  [./slide]
+    type = ParsedFunction
+    value = 0.1*t*x*(3-x)
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  [../]
+
+  [./lm]
+    order = FIRST
+    family = LAGRANGE
+    block = middle
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxKernels]
+  [./slide]
+    type = FunctionAux
+    variable = disp_x
+    function = slide
+    block = 2
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Constraints]
+  [./ced]
+    type = EqualValueConstraint
+    variable = lm
+    interface = middle
+    master_variable = u
+    use_displaced_mesh = true
+  [../]
+[]
+
+[BCs]
+  [./all]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = '1 2 3 4'
+    function = exact_sln
+  [../]
+[]
+
+[Preconditioning]
+  [./fmp]
+    type = SMP
+    full = true
+    solve_type = 'NEWTON'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.5
+  nl_rel_tol = 1e-15
+  l_tol = 1e-15
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,44 @@
+# Reads back an oversampled output restricted to a region of interest (the mesh
+# file is given on the command line) and measures the mesh and the solution
+# written to it. The solution of oversample.i is u = x - 1 on the shifted mesh.
+[Mesh]
+  file = oversample_region_box.e
+[]
+
+[AuxVariables]
+  [./u]
+    initial_from_file_var = u
+    initial_from_file_timestep = LATEST
+  [../]
+[]
+
+[Postprocessors]
+  [./num_elems]
+    type = NumElems
+  [../]
+  [./area]
+    type = VolumePostprocessor
+  [../]
+  [./u_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+  [./u_max]
+    type = NodalExtremeValue
+    variable = u
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
@@ -0,0 +1,88 @@
+#!/usr/bin/env python2
+#* This file is part of the MOOSE framework
+#* https://www.mooseframework.org
+#*
+#* All rights reserved, see COPYRIGHT for full restrictions
+#* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+#*
+#* Licensed under LGPL 2.1, please see LICENSE for details
+#* https://www.gnu.org/licenses/lgpl-2.1.html
+
+"""
+Checks the datasets written by the XDMF output of xdmf.i, which are read with h5dump.
+
+The mesh is the unit square with 10x10 elements, the elemental variable is x + y at the element
+centroids and the nodal variable is 0 on the left and 1 on the right boundary. When a compression
+level is given as the second argument, the datasets must also use the deflate filter at that level.
+"""
+
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+def read(file_name, dataset):
+    """Return the values of a dataset as a flat list of floats."""
+    handle, data_file = tempfile.mkstemp()
+    os.close(handle)
+    try:
+        with open(os.devnull, 'w') as devnull:
+            subprocess.check_call(['h5dump', '-d', dataset, '-y', '-w', '0', '-o', data_file,
+                                   file_name], stdout=devnull)
+        with open(data_file) as f:
+            return [float(v) for v in re.findall(r'[-+0-9.eE]+', f.read())]
+    finally:
+        os.remove(data_file)
+
+def compression(file_name, dataset):
+    """Return the deflate level of a dataset, or None when it is not compressed."""
+    output = subprocess.check_output(['h5dump', '-p', '-H', '-d', dataset, file_name])
+    match = re.search(r'COMPRESSION\s+DEFLATE\s*{\s*LEVEL\s+(\d+)', output)
+    return int(match.group(1)) if match else None
+
+def check(condition, message):
+    if not condition:
+        print('ERROR: ' + message)
+        sys.exit(1)
+
+def main(file_name, level=None):
+    if level is not None:
+        for dataset in ['/mesh_0/coordinates', '/mesh_0/connectivity', '/output_3/elemental',
+                        '/output_3/u']:
+            check(compression(file_name, dataset) == level,
+                  'expected %s to be compressed with the deflate level %d' % (dataset, level))
+
+    coordinates = read(file_name, '/mesh_0/coordinates')
+    check(len(coordinates) == 121 * 3, 'expected 121 nodes')
+    nodes = [coordinates[3 * i:3 * i + 3] for i in range(121)]
+    for node in nodes:
+        check(all(-1e-12 <= v <= 1 + 1e-12 for v in node[0:2]) and node[2] == 0,
+              'node outside of the mesh: %s' % node)
+
+    # Each cell is the quadrilateral type (5) followed by the four vertex rows
+    connectivity = [int(v) for v in read(file_name, '/mesh_0/connectivity')]
+    check(len(connectivity) == 500, 'expected 100 quadrilaterals')
+    cells = [connectivity[5 * i:5 * i + 5] for i in range(100)]
+    for cell in cells:
+        check(cell[0] == 5 and all(0 <= n < 121 for n in cell[1:]), 'invalid cell: %s' % cell)
+
+    # The elemental values are stored in the same order as the cells
+    elemental = read(file_name, '/output_3/elemental')
+    check(len(elemental) == 100, 'expected 100 elemental values')
+    for cell, value in zip(cells, elemental):
+        centroid = [sum(nodes[n][d] for n in cell[1:]) / 4. for d in range(2)]
+        check(abs(value - centroid[0] - centroid[1]) < 1e-10,
+              'elemental value %g does not match the cell at %s' % (value, centroid))
+
+    # The nodal values are stored in the rows of the nodes
+    u = read(file_name, '/output_3/u')
+    check(len(u) == 121, 'expected 121 nodal values')
+    for node, value in zip(nodes, u):
+        if abs(node[0]) < 1e-12 or abs(node[0] - 1) < 1e-12:
+            check(abs(value - node[0]) < 1e-10,
+                  'nodal value %g does not match the boundary condition at %s' % (value, node))
+        check(-1e-10 <= value <= 1 + 1e-10, 'nodal value %g out of bounds' % value)
+
+if __name__ == '__main__':
+    main(sys.argv[1], int(sys.argv[2]) if len(sys.argv) > 2 else None)
@@ -0,0 +1,94 @@
+# The sub-application solutions are t * x / 0.2 in their own coordinates, so the transferred values
+# change with each transfer and the cached transfer plans are used from the second time step on
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./transferred_u]
+  [../]
+  [./elemental_transferred_u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  # The node (0.1, 0.1) is at x = 0.05 in the first sub-application
+  [./nodal_value]
+    type = PointValue
+    variable = transferred_u
+    point = '0.1 0.1 0'
+  [../]
+  # The centroid (0.15, 0.15) is at x = 0.1 in the first sub-application
+  [./elemental_value]
+    type = PointValue
+    variable = elemental_transferred_u
+    point = '0.15 0.15 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '.05 .05 0 .55 .55 0 0.55 0.05 0'
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    input_files = fixed_meshes_fromsub_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    source_variable = 'sub_u sub_u'
+    direction = from_multiapp
+    variable = 'transferred_u elemental_transferred_u'
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+[]
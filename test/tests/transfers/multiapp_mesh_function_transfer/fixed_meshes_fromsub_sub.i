@@ -0,0 +1,54 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmax = 0.2
+  ymax = 0.2
+[]
+
+[Variables]
+  [./sub_u]
+  [../]
+[]
+
+[Functions]
+  [./right]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = sub_u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = sub_u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = FunctionDirichletBC
+    variable = sub_u
+    boundary = right
+    function = right
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+[]
@@ -0,0 +1,83 @@
+# The master solution is u = t * x, so the transferred values change with each transfer and the
+# cached transfer plans are used from the second time step on
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./right]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = FunctionDirichletBC
+    variable = u
+    boundary = right
+    function = right
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '.1 .1 0 0.6 0.6 0 0.6 0.1 0'
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    input_files = fixed_meshes_tosub_sub.i
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    source_variable = u
+    direction = to_multiapp
+    variable = transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+
+  [./elemental_to_sub]
+    source_variable = u
+    direction = to_multiapp
+    variable = elemental_transferred_u
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+[]
@@ -0,0 +1,58 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u]
+  [../]
+[]
+
+[AuxKernels]
+  [./u]
+    type = FunctionAux
+    variable = u
+    function = '1 + x + 2 * y'
+    execute_on = initial
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    execute_on = timestep_end
+    # Half of the sub-application lies outside of the master mesh
+    positions = '0.5 0 0'
+    input_files = preserve_integral_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./to_sub]
+    type = MultiAppProjectionTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = u
+    preserve_integral = true
+  [../]
+[]
@@ -0,0 +1,50 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[MeshModifiers]
+  # The elements inside of the master mesh
+  [./inside]
+    type = SubdomainBoundingBox
+    bottom_left = '0 0 0'
+    top_right = '0.5 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./v]
+  [../]
+[]
+
+[AuxVariables]
+  [./u]
+  [../]
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[Postprocessors]
+  # The integral of the master solution over the inside elements is 1.375
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+    block = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+[]
+
+[Outputs]
+  csv = true
+[]